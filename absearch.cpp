@@ -24,98 +24,300 @@
  *  @brief Artificial intelligence, alpha-beta pruning.
  */
 
+extern "C"
+{
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+}
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <stdexcept>
 #include "absearch.hpp"
 #include "nonstdio.hpp"
 
 namespace checkers
 {
-	int absearch::alpha_beta_search(std::vector<move>& best_moves,
-		unsigned int depth, int alpha, int beta, unsigned int ply)
+	absearch::state::state(bool parallel) :
+		_context(NULL), _index(0), _parallel(parallel), _pool(NULL),
+		_split(NULL), _best_moves(), _optimize_move(false),
+		_excluded_moves(), _nodes(0), _total_nodes(0), _depth(0),
+		_value(0), _hash(absearch::_hash_size), _table(&this->_hash),
+		_path()
+	{
+		if (!absearch::_shared_hash.empty())
+		{
+			this->_hash.share(absearch::_shared_hash);
+		}
+	}
+
+	/**  The hash table of its own has no slots.  The context and the
+	 *   hash table are of the split point searched, see
+	 *   split_point::search().
+	 */
+	absearch::state::state(thread_pool& pool, unsigned int index) :
+		_context(NULL), _index(index), _parallel(false), _pool(&pool),
+		_split(NULL), _best_moves(), _optimize_move(false),
+		_excluded_moves(), _nodes(0), _total_nodes(0), _depth(0),
+		_value(0), _hash(0), _table(NULL), _path()
+	{
+	}
+
+	/**  The file is absearch::hash_magic, then the records in the format
+	 *   of record::write(), the empty records are skipped.
+	 */
+	std::size_t absearch::state::save_hash(const std::string& path,
+		unsigned int depth) const
 	{
-		if (0 == this->_nodes % (2 ^ 16))
+		std::ofstream ofs(path.c_str(),
+			std::ios::out | std::ios::binary | std::ios::trunc);
+		std::size_t size = 0;
+
+		ofs.write(absearch::hash_magic, sizeof(absearch::hash_magic));
+		for (std::size_t i = 0; i < this->_hash.size(); ++i)
 		{
-			nio << io::flush;
-			if (this->is_timeout() || nio.lines_to_read() ||
-				nio.eof())
+			const record record = this->_hash[i];
+			if (record.get_zobrist().key() &&
+				record.get_depth() >= depth)
 			{
-	 			/// @retval absearch::unknown() when timeout
-				return evaluate::unknown();
+				record.write(ofs);
+				++size;
 			}
 		}
-		++this->_nodes;
 
-		// The default flag type is ALPHA
-		record::hash_flag flag = record::ALPHA;
-		// Try to get the evalute record from the hash table
-		int val = this->probe_hash(depth, alpha, beta, best_moves);
+		ofs.close();
+		if (!ofs)
+		{
+			/// @throw std::runtime_error when the file is not written.
+			throw std::runtime_error("Error (cannot write): " + path);
+		}
+		return size;
+	}
 
-		if (evaluate::unknown() != val)
+	/**  The file is mapped into memory, and read in place.  The records
+	 *   are stored as the records of the current search.
+	 */
+	std::size_t absearch::state::load_hash(const std::string& path)
+	{
+		int fd = open(path.c_str(), O_RDONLY);
+		struct stat st;
+
+		if (fd < 0 || fstat(fd, &st) < 0)
 		{
-			if (evaluate::win() == val)
+			const int error = errno;
+			if (fd >= 0)
 			{
-				return evaluate::win() - ply;
+				close(fd);
 			}
-			else if (-evaluate::win() == val)
+			/// @throw std::runtime_error when the file is not opened.
+			throw std::runtime_error("Error (cannot open): " + path +
+				": " + std::strerror(error));
+		}
+
+		const std::size_t length = st.st_size;
+		void* map = length < sizeof(absearch::hash_magic) ? MAP_FAILED :
+			mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (MAP_FAILED == map || std::memcmp(map, absearch::hash_magic,
+			sizeof(absearch::hash_magic)))
+		{
+			if (MAP_FAILED != map)
 			{
-				return -evaluate::win() + ply;
+				munmap(map, length);
 			}
-			else
+			/// @throw std::logic_error when it is not a hash file.
+			throw std::logic_error("Error (illegal hash file): " +
+				path);
+		}
+		madvise(map, length, MADV_SEQUENTIAL);
+
+		const unsigned char* buf = static_cast<const unsigned char*>(map);
+		std::size_t offset = sizeof(absearch::hash_magic);
+		std::size_t size = 0;
+		std::size_t bytes;
+		record record;
+
+		while ((bytes = record.read(buf + offset, length - offset)) > 0)
+		{
+			this->_hash.store(record);
+			offset += bytes;
+			++size;
+		}
+
+		munmap(map, length);
+		return size;
+	}
+
+	// ================================================================
+
+	int absearch::alpha_beta_search(std::vector<packed_move>& best_moves,
+		unsigned int depth, int alpha, int beta, unsigned int ply)
+	{
+		// The node limit is exact on one thread, the clock and the
+		// input are checked every so many nodes, by the thinking thread
+		// only.  A helper thread stops with it, and when its split
+		// point cuts off.
+		const long unsigned int nodes =
+			this->_state._total_nodes + this->_state._nodes;
+		if ((0 == this->_state._index ?
+			this->_state._context->is_out_of_nodes(nodes) ||
+			(0 == this->_state._nodes % absearch::check_nodes &&
+			this->_state._context->check(nodes)) :
+			0 == this->_state._nodes % absearch::check_nodes &&
+			this->_state._context->is_stopped()) ||
+			(this->_state._split &&
+			this->_state._split->is_cut_off()))
+		{
+			/// @retval absearch::unknown() when stopped
+			return evaluate::unknown();
+		}
+		++this->_state._nodes;
+
+		// A repeated position, or one after the 40-move rule, is a draw
+		if (ply > 0 && (this->is_repetition() ||
+			this->_board.get_reversible_moves() >=
+			board::REVERSIBLE_MOVES_LIMIT))
+		{
+			best_moves.clear();
+			return evaluate::draw();
+		}
+
+		// A win or a loss is not nearer than the current ply
+		if (ply > 0)
+		{
+			alpha = std::max(alpha, -evaluate::win() +
+				static_cast<int>(ply));
+			beta = std::min(beta, evaluate::win() -
+				static_cast<int>(ply));
+			if (alpha >= beta)
 			{
-				return val;
+				best_moves.clear();
+				return alpha;
 			}
 		}
+
+		// The root is searched without the ranked moves
+		const bool exclude = 0 == ply &&
+			!this->_state._excluded_moves.empty();
+		// The default flag type is ALPHA
+		record::hash_flag flag = record::ALPHA;
+		packed_move hash_move;
+		// Try to get the evalute record from the hash table
+		int val = exclude ? evaluate::unknown() :
+			this->probe_hash(depth, alpha, beta, ply, best_moves,
+			hash_move);
+
+		if (evaluate::unknown() != val)
+		{
+			return val;
+		}
 		else if (this->_board.is_winning())
 		{
-			this->record_hash(depth, evaluate::win(),
-				record::EXACT);
-			return evaluate::win() - ply;
+			val = evaluate::win() - static_cast<int>(ply);
+			this->record_hash(depth, val, record::EXACT, ply);
+			return val;
 		}
 		else if (this->_board.is_losing())
 		{
-			this->record_hash(depth, -evaluate::win(),
-				record::EXACT);
-			return -evaluate::win() + ply;
+			val = -evaluate::win() + static_cast<int>(ply);
+			this->record_hash(depth, val, record::EXACT, ply);
+			return val;
 		}
 		else if (0 == depth)
 		{
 			best_moves.clear();
 			val = evaluate::evaluate(this->_board);
-			this->record_hash(depth, val, record::EXACT);
+			this->record_hash(depth, val, record::EXACT, ply);
 			return val;
 		}
 
-		// Generate all the legal moves
-		std::vector<move> legal_moves = this->_board.generate_moves();
-		// Optimize the order of legal moves
-		this->optimize_moves(legal_moves, ply);
+		// Generate the legal moves only after the hash move
+		move_picker picker(*this, hash_move, depth, beta, ply);
+		packed_move move;
 
-		std::vector<move> deeper_moves;
+		std::vector<packed_move> deeper_moves;
+		unsigned int searched = 0;
+		// The moves counted as searched, but skipped by the hash table
+		unsigned int skipped = 0;
+		// Quiet moves can not raise the static value by the margin
+		const int futility = absearch::_futility && ply > 0 &&
+			depth <= absearch::futility_depth ?
+			evaluate::evaluate(this->_board) +
+			absearch::futility_margin * static_cast<int>(depth) :
+			evaluate::infinity();
 
-		for (std::vector<move>::const_iterator pos =
-			legal_moves.begin(); pos != legal_moves.end(); ++pos)
+		while (picker.next(move, alpha))
 		{
+			if (exclude && this->_state._excluded_moves.end() !=
+				std::find(this->_state._excluded_moves.begin(),
+				this->_state._excluded_moves.end(), move))
+			{
+				continue;
+			}
+
 			// While capture piece in the last ply, search deeper
-			if (1 == depth && pos->get_capture())
+			if (1 == depth && move.get_capture())
 			{
 				++depth;
 			}
 
-			absearch absearch(*this);
-			val = absearch._board.make_move(*pos) ?
-				 absearch.alpha_beta_search(deeper_moves,
-					depth,     alpha,   beta, ply + 1) :
-				-absearch.alpha_beta_search(deeper_moves,
-					depth - 1, -beta, -alpha, ply + 1);
+			// A child whose record fails low or high is not made
+			val = picker.get_value();
+			if (val >= beta)
+			{
+				this->record_hash(depth, beta, record::BETA, ply,
+					move);
+				return beta;
+			}
+			if (evaluate::unknown() != val && val <= alpha &&
+				!this->_state._optimize_move)
+			{
+				++searched;
+				++skipped;
+				continue;
+			}
+
+			// The younger brothers are searched together, after
+			// the eldest one is searched, not skipped by its record.
+			if (searched > skipped && !exclude && this->_state._pool &&
+				depth >= absearch::split_depth &&
+				!this->_state._optimize_move &&
+				this->_state._pool->is_idle())
+			{
+				val = this->split(picker, move, depth, alpha, beta,
+					ply, futility, searched, best_moves);
+				if (evaluate::unknown() == val)
+				{
+					return val;
+				}
+				if (val >= beta)
+				{
+					this->record_hash(depth, beta, record::BETA,
+						ply, best_moves.front());
+					return beta;
+				}
+				if (val > alpha)
+				{
+					flag = record::EXACT;
+					alpha = val;
+				}
+				break;
+			}
 
+			val = this->search_move(move, depth, alpha, beta, ply,
+				futility, searched, deeper_moves);
 			if (evaluate::unknown() == val)
 			{
 				return val;
 			}
 			if (val >= beta)
 			{
-				this->record_hash(depth, beta, record::BETA);
+				this->record_hash(depth, beta, record::BETA, ply,
+					move);
 				return beta;
 			}
 			if (val > alpha)
@@ -123,29 +325,158 @@ namespace checkers
 				flag = record::EXACT;
 				alpha = val;
 				best_moves.clear();
-				best_moves.push_back(*pos);
+				best_moves.push_back(move);
 				best_moves.insert(best_moves.end(),
 					deeper_moves.begin(),
 					deeper_moves.end());
 			}
 		}
 
+		if (exclude)
+		{
+			return alpha;
+		}
 		if (record::EXACT == flag)
 		{
-			this->record_hash(depth, alpha, flag, best_moves);
+			this->record_hash(depth, alpha, flag, ply,
+				best_moves.front());
 		}
 		else
 		{
-			this->record_hash(depth, alpha, flag);
+			this->record_hash(depth, alpha, flag, ply);
 		}
 		return alpha;
 	}
 
-	/** @return Timeout or not.
+	int absearch::search_move(const packed_move& move, unsigned int depth,
+		int alpha, int beta, unsigned int ply, int futility,
+		unsigned int& searched, std::vector<packed_move>& best_moves)
+	{
+		int val;
+		absearch absearch(*this);
+		bool contin = absearch._board.make_move(move);
+		const bool quiet = !move.get_capture() && !move.will_crown();
+
+		// A quiet move near the leaves, which can not raise the value
+		// to alpha, is not searched when the value is below alpha by
+		// a margin more.  Otherwise it is verified in a null window
+		// one ply shallower than its full search first, and searched
+		// when it raises alpha.
+		const bool futile = futility <= alpha && quiet && searched > 0 &&
+			absearch.is_quiet();
+		if (futile && futility + absearch::futility_margin <= alpha)
+		{
+			return -evaluate::infinity();
+		}
+		if (!futile)
+		{
+			++searched;
+		}
+
+		this->_state._path.push_back(this->_board.get_zobrist());
+		bool full = true;
+		if (futile && depth > 1)
+		{
+			val = absearch.alpha_beta_search(best_moves, depth - 2,
+				-alpha - 1, -alpha, ply + 1);
+			full = evaluate::unknown() != val && -val > alpha;
+		}
+		// A late quiet move is searched shallower in a null window
+		// first, and again when it raises alpha.
+		else if (absearch::_reductions && quiet && ply > 0 &&
+			searched > absearch::late_moves &&
+			depth >= absearch::reduction_depth)
+		{
+			val = absearch.alpha_beta_search(best_moves, depth - 2,
+				-alpha - 1, -alpha, ply + 1);
+			full = evaluate::unknown() != val && -val > alpha;
+		}
+		if (full)
+		{
+			if (futile)
+			{
+				++searched;
+			}
+			val = contin ?
+				absearch.alpha_beta_search(best_moves,
+					depth,     alpha,   beta, ply + 1) :
+				absearch.alpha_beta_search(best_moves,
+					depth - 1, -beta, -alpha, ply + 1);
+		}
+		this->_state._path.pop_back();
+
+		// Check before negating, -unknown() overflows.
+		if (evaluate::unknown() == val || contin)
+		{
+			return val;
+		}
+		return -val;
+	}
+
+	/**  The tasks are pushed in the reverse order, so that the thread
+	 *   pops them in order, and the idle threads steal the last ones.
+	 *   The thread waits for the stolen ones after its own.
+	 */
+	int absearch::split(move_picker& picker, const packed_move& move,
+		unsigned int depth, int alpha, int beta, unsigned int ply,
+		int futility, unsigned int searched,
+		std::vector<packed_move>& best_moves)
+	{
+		std::vector<packed_move> moves(1, move);
+		packed_move next;
+
+		// The children are looked up already, see move_picker::next()
+		while (picker.next(next, alpha))
+		{
+			const int val = picker.get_value();
+			if (evaluate::unknown() == val || val > alpha)
+			{
+				moves.push_back(next);
+			}
+		}
+
+		split_point split(*this, depth, alpha, beta, ply, futility,
+			moves.size());
+		std::vector<task> tasks(moves.size());
+		for (std::vector<packed_move>::size_type i = 0;
+			i < moves.size(); ++i)
+		{
+			task& task = tasks[moves.size() - 1 - i];
+			task.split = &split;
+			task.move = moves[i];
+			task.searched = searched + i;
+		}
+
+		task task;
+		this->_state._pool->push(this->_state, tasks);
+		while (this->_state._pool->pop(this->_state, &split, task))
+		{
+			split.search(task, this->_state);
+		}
+		split.wait();
+
+		this->_state._nodes += split._nodes;
+		if (split._alpha > alpha)
+		{
+			best_moves = split._best_moves;
+		}
+		return split._stopped && !split._cut_off ?
+			evaluate::unknown() : split._alpha;
+	}
+
+	/** @return Stopped or not.
 	 */ 
-	bool absearch::think(std::vector<move>& best_moves,
-		const board& board, unsigned int depth_limit, time_t time_limit,
-		bool verbose)
+	bool absearch::think(std::vector<packed_move>& best_moves,
+		const board& board, search_context& context, bool verbose,
+		unsigned int multipv)
+	{
+		return absearch::think(absearch::_engine_state, best_moves,
+			board, context, verbose, multipv);
+	}
+
+	bool absearch::think(state& state,
+		std::vector<packed_move>& best_moves, const board& board,
+		search_context& context, bool verbose, unsigned int multipv)
 	{
 		unsigned int i;
 		unsigned int depth;
@@ -153,37 +484,174 @@ namespace checkers
 		struct timeval start;
 		struct timeval end;
 
-		absearch::set_timeout(time_limit);
+		state._context = &context;
+		state._hash.next_generation();
+		state._total_nodes = 0;
+		state._depth = 0;
+		state._value = 0;
+
+		// The thinking thread takes the deque 0 of the helper threads
+		state._pool = state._parallel ? absearch::_thread_pool : NULL;
+
+		if (multipv > 1)
+		{
+			return absearch::think_multipv(state, best_moves, board,
+				verbose, multipv);
+		}
 
 		for (i = 0, depth = std::max(best_moves.size(),
-			static_cast<std::vector<move>::size_type>(1U)), val = 0;
-			depth <= depth_limit && val != evaluate::unknown();
+			static_cast<std::vector<packed_move>::size_type>(1U)),
+			val = 0;
+			depth <= context.get_depth() &&
+			val != evaluate::unknown();
 			++i, ++depth)
 		{
-			absearch::_nodes = 0;
-			absearch::_best_moves = best_moves;
-			absearch::_optimize_move = true;
+			state._nodes = 0;
+			state._best_moves = best_moves;
+			state._optimize_move = true;
 
-			absearch absearch(board);
+			absearch absearch(board, state);
 			start = timeval::now();
 			val = absearch.alpha_beta_search(best_moves,
 				depth);
 			end = timeval::now();
 
+			state._total_nodes += state._nodes;
+			if (evaluate::unknown() != val)
+			{
+				absearch.hash_line(best_moves, depth);
+				state._depth = depth;
+				state._value = val;
+			}
+
 			if (verbose)
 			{
 				nio << absearch::thinking_detail(depth,
-					val, end - start, absearch::_nodes,
+					val, end - start, state._nodes,
 					best_moves, !(i % 8));
 			}
 
-			if (best_moves.size() < depth)
+			// The game ends within the depth
+			if (best_moves.size() < depth &&
+				evaluate::is_decisive(val))
+			{
+				break;
+			}
+		}
+
+		if (verbose)
+		{
+			nio << absearch::hash_detail(state._hash);
+		}
+
+		/** @retval true while stopped.
+		 *  @retval false while reach specified search depth or game
+		 *   end.
+		 */
+		return val == evaluate::unknown();
+	}
+
+	/**  Search the root once for each rank, without the root moves ranked
+	 *   better at the same depth, in a full window to get exact values.
+	 *   All the searches share the hash table, only the root position is
+	 *   neither probed nor recorded.
+	 *  @return Stopped or not.
+	 */
+	bool absearch::think_multipv(state& state,
+		std::vector<packed_move>& best_moves, const board& board,
+		bool verbose, unsigned int multipv)
+	{
+		unsigned int i;
+		unsigned int depth;
+		int val = 0;
+		int best_val = 0;
+		struct timeval start;
+		struct timeval end;
+
+		std::vector<std::vector<packed_move> > lines(std::min(
+			static_cast<std::vector<packed_move>::size_type>(multipv),
+			board.generate_moves().size()));
+		if (lines.empty())
+		{
+			best_moves.clear();
+			return false;
+		}
+		lines[0] = best_moves;
+
+		for (i = 0, depth = 1;
+			depth <= state._context->get_depth() &&
+			val != evaluate::unknown();
+			++i, ++depth)
+		{
+			state._excluded_moves.clear();
+
+			for (std::vector<std::vector<packed_move> >::size_type
+				k = 0; k < lines.size(); ++k)
+			{
+				state._nodes = 0;
+				state._best_moves = lines[k];
+				state._optimize_move = true;
+
+				absearch absearch(board, state);
+				start = timeval::now();
+				val = absearch.alpha_beta_search(lines[k],
+					depth);
+				end = timeval::now();
+
+				state._total_nodes += state._nodes;
+				if (evaluate::unknown() != val)
+				{
+					absearch.hash_line(lines[k], depth);
+				}
+
+				if (verbose)
+				{
+					nio << absearch::thinking_detail(depth,
+						val, end - start,
+						state._nodes, lines[k],
+						0 == k && !(i % 8));
+				}
+
+				if (evaluate::unknown() == val)
+				{
+					break;
+				}
+				if (0 == k)
+				{
+					best_val = val;
+				}
+				// A root decided without a move ranks no more
+				if (lines[k].empty())
+				{
+					break;
+				}
+				state._excluded_moves.push_back(
+					lines[k].front());
+			}
+
+			state._excluded_moves.clear();
+
+			if (evaluate::unknown() != val)
+			{
+				state._depth = depth;
+				state._value = best_val;
+			}
+
+			if (lines[0].size() < depth &&
+				evaluate::is_decisive(best_val))
 			{
 				break;
 			}
 		}
 
-		/** @retval true while timeout.
+		best_moves = lines[0];
+
+		if (verbose)
+		{
+			nio << absearch::hash_detail(state._hash);
+		}
+
+		/** @retval true while stopped.
 		 *  @retval false while reach specified search depth or game
 		 *   end.
 		 */
@@ -192,9 +660,387 @@ namespace checkers
 
 	// ================================================================
 
+	/**  The moves along the best moves of the last search are ordered by
+	 *   them instead, see optimize_moves().  Where the children are
+	 *   looked up, all the moves are generated first, the hash move
+	 *   among them, and a child proving a cutoff cuts off before any is
+	 *   searched, see transposition_cutoff().  Elsewhere the hash move is
+	 *   searched before the moves are generated, it is checked before it
+	 *   is made, a record of another position may have the same zobrist
+	 *   key.
+	 */
+	bool absearch::move_picker::next(packed_move& move, int alpha)
+	{
+		if (HASH_MOVE == this->_stage)
+		{
+			this->_stage = GENERATE;
+			if (!this->_search._state._optimize_move &&
+				packed_move() != this->_hash_move &&
+				this->_search._board.is_pseudo_legal(
+				this->_hash_move))
+			{
+				move = this->_hash_move;
+				this->_value = this->probe(move, alpha);
+				return true;
+			}
+			this->_hash_move = packed_move();
+		}
+		if (GENERATE == this->_stage)
+		{
+			this->_stage = CUTOFF;
+			this->_moves = this->_search._board.generate_moves();
+			this->_search.prefetch_children(this->_moves);
+			this->_search.optimize_moves(this->_moves, this->_ply);
+			const std::vector<packed_move>::iterator pos = std::find(
+				this->_moves.begin(), this->_moves.end(),
+				this->_hash_move);
+			if (!this->_probe)
+			{
+				// The hash move is searched already
+				if (this->_moves.end() != pos)
+				{
+					this->_moves.erase(pos);
+				}
+			}
+			else if (this->_moves.end() != pos &&
+				!this->_search._state._optimize_move)
+			{
+				// The hash move is searched first
+				std::rotate(this->_moves.begin(), pos, pos + 1);
+			}
+		}
+		if (CUTOFF == this->_stage)
+		{
+			this->_stage = MOVES;
+			if (this->_probe)
+			{
+				move = this->_search.transposition_cutoff(
+					this->_moves, this->_depth, alpha,
+					this->_beta, this->_ply, this->_values);
+				if (packed_move() != move)
+				{
+					this->_value = this->_values.back();
+					this->_index = this->_moves.size();
+					return true;
+				}
+			}
+		}
+		if (this->_index < this->_moves.size())
+		{
+			move = this->_moves[this->_index];
+			this->_value = this->_index < this->_values.size() ?
+				this->_values[this->_index] :
+				this->probe(move, alpha);
+			++this->_index;
+			return true;
+		}
+		return false;
+	}
+
+	/**  Below the root, the child of a move not looked up by the
+	 *   enhanced transposition cutoffs is looked up alone, just before
+	 *   it would be made.
+	 */
+	int absearch::move_picker::probe(const packed_move& move, int alpha)
+		const
+	{
+		return this->_ply > 0 ? this->_search.probe_child(move,
+			this->_depth, alpha, this->_beta, this->_ply) :
+			evaluate::unknown();
+	}
+
+	// ================================================================
+
+	/**  The split point copies the board and the path of the node, the
+	 *   thread searching a task may be another one than the owner.
+	 */
+	absearch::split_point::split_point(const absearch& search,
+		unsigned int depth, int alpha, int beta, unsigned int ply,
+		int futility, unsigned int tasks) :
+		_board(search._board), _owner(search._state),
+		_parent(search._state._split), _depth(depth), _alpha(alpha),
+		_beta(beta), _ply(ply), _futility(futility),
+		_path(search._state._path), _mutex(), _cond(),
+		_unfinished(tasks), _cut_off(false), _stopped(false),
+		_best_moves(), _nodes(0)
+	{
+		pthread_mutex_init(&this->_mutex, NULL);
+		pthread_cond_init(&this->_cond, NULL);
+	}
+
+	absearch::split_point::~split_point(void)
+	{
+		pthread_cond_destroy(&this->_cond);
+		pthread_mutex_destroy(&this->_mutex);
+	}
+
+	/**  The move is searched in the window of the node, with alpha
+	 *   raised by the moves searched already.  A move is not searched
+	 *   once the split point cuts off.
+	 */
+	void absearch::split_point::search(const task& task, state& state)
+	{
+		std::vector<packed_move> best_moves;
+		int val = evaluate::unknown();
+
+		if (!this->is_cut_off())
+		{
+			pthread_mutex_lock(&this->_mutex);
+			const int alpha = this->_alpha;
+			pthread_mutex_unlock(&this->_mutex);
+
+			split_point* const split = state._split;
+			const long unsigned int nodes = state._nodes;
+			unsigned int searched = task.searched;
+
+			state._split = this;
+			if (&state != &this->_owner)
+			{
+				state._context = this->_owner._context;
+				state._table = this->_owner._table;
+				state._path = this->_path;
+			}
+			absearch search(this->_board, state);
+			val = search.search_move(task.move, this->_depth, alpha,
+				this->_beta, this->_ply, this->_futility, searched,
+				best_moves);
+			state._split = split;
+
+			if (&state != &this->_owner)
+			{
+				pthread_mutex_lock(&this->_mutex);
+				this->_nodes += state._nodes - nodes;
+				pthread_mutex_unlock(&this->_mutex);
+			}
+		}
+
+		pthread_mutex_lock(&this->_mutex);
+		if (evaluate::unknown() == val)
+		{
+			// Stopped, or cut off above
+			this->_stopped = this->_stopped || !this->_cut_off;
+		}
+		else if (val > this->_alpha && !this->_cut_off)
+		{
+			this->_alpha = val;
+			this->_best_moves.clear();
+			this->_best_moves.push_back(task.move);
+			this->_best_moves.insert(this->_best_moves.end(),
+				best_moves.begin(), best_moves.end());
+			if (val >= this->_beta)
+			{
+				__atomic_store_n(&this->_cut_off, true,
+					__ATOMIC_RELEASE);
+			}
+		}
+		--this->_unfinished;
+		pthread_cond_signal(&this->_cond);
+		pthread_mutex_unlock(&this->_mutex);
+	}
+
+	/**  The thinking thread checks the search context meanwhile, the
+	 *   helper threads stop with it.
+	 */
+	void absearch::split_point::wait(void)
+	{
+		const struct timeval delay = {
+			0, absearch::wait_milliseconds * 1000
+		};
+
+		pthread_mutex_lock(&this->_mutex);
+		while (this->_unfinished > 0)
+		{
+			const struct timeval deadline = timeval::now() + delay;
+			const struct timespec timeout = {
+				deadline.tv_sec, deadline.tv_usec * 1000
+			};
+
+			pthread_cond_timedwait(&this->_cond, &this->_mutex,
+				&timeout);
+			if (0 == this->_owner._index)
+			{
+				this->_owner._context->check(
+					this->_owner._total_nodes +
+					this->_owner._nodes + this->_nodes);
+			}
+		}
+		pthread_mutex_unlock(&this->_mutex);
+	}
+
+	// ================================================================
+
+	/**  The deque 0 is of the thinking thread.
+	 */
+	absearch::thread_pool::thread_pool(unsigned int helpers) :
+		_helpers(), _tids(), _deques(helpers + 1), _mutex(), _cond(),
+		_idle(0), _quit(false)
+	{
+		pthread_mutex_init(&this->_mutex, NULL);
+		pthread_cond_init(&this->_cond, NULL);
+
+		for (unsigned int i = 1; i <= helpers; ++i)
+		{
+			this->_helpers.push_back(new state(*this, i));
+		}
+		for (std::vector<state*>::const_iterator pos =
+			this->_helpers.begin(); pos != this->_helpers.end(); ++pos)
+		{
+			pthread_t tid;
+			const int error = pthread_create(&tid, NULL,
+				&thread_pool::worker, *pos);
+			if (error != 0)
+			{
+				this->quit();
+				pthread_cond_destroy(&this->_cond);
+				pthread_mutex_destroy(&this->_mutex);
+				/** @throw std::runtime_error when
+				 *   pthread_create() failed.
+				 */
+				throw std::runtime_error(
+					std::string("pthread_create() failed: ") +
+					std::strerror(error));
+			}
+			this->_tids.push_back(tid);
+		}
+	}
+
+	absearch::thread_pool::~thread_pool(void)
+	{
+		this->quit();
+		pthread_cond_destroy(&this->_cond);
+		pthread_mutex_destroy(&this->_mutex);
+	}
+
+	void absearch::thread_pool::push(const state& state,
+		const std::vector<task>& tasks)
+	{
+		pthread_mutex_lock(&this->_mutex);
+		this->_deques[state._index].insert(
+			this->_deques[state._index].end(),
+			tasks.begin(), tasks.end());
+		pthread_cond_broadcast(&this->_cond);
+		pthread_mutex_unlock(&this->_mutex);
+	}
+
+	/**  The tasks of the other split points of the thread are in the
+	 *   front, its split points above are not done yet.
+	 */
+	bool absearch::thread_pool::pop(const state& state,
+		const split_point* split, task& task)
+	{
+		std::deque<checkers::absearch::task>& deque =
+			this->_deques[state._index];
+		bool popped;
+
+		pthread_mutex_lock(&this->_mutex);
+		popped = !deque.empty() && split == deque.back().split;
+		if (popped)
+		{
+			task = deque.back();
+			deque.pop_back();
+		}
+		pthread_mutex_unlock(&this->_mutex);
+
+		return popped;
+	}
+
+	void* absearch::thread_pool::worker(void* arg)
+	{
+		state& state = *static_cast<absearch::state*>(arg);
+
+		state._pool->run(state);
+		return NULL;
+	}
+
+	void absearch::thread_pool::run(state& state)
+	{
+		task task;
+
+		pthread_mutex_lock(&this->_mutex);
+		while (!this->_quit)
+		{
+			if (!this->steal(task))
+			{
+				__atomic_add_fetch(&this->_idle, 1,
+					__ATOMIC_RELAXED);
+				pthread_cond_wait(&this->_cond, &this->_mutex);
+				__atomic_sub_fetch(&this->_idle, 1,
+					__ATOMIC_RELAXED);
+				continue;
+			}
+
+			pthread_mutex_unlock(&this->_mutex);
+			task.split->search(task, state);
+			pthread_mutex_lock(&this->_mutex);
+		}
+		pthread_mutex_unlock(&this->_mutex);
+	}
+
+	/**  The task at the front is of the split point nearest to the
+	 *   root, which leaves the most work.
+	 */
+	bool absearch::thread_pool::steal(task& task)
+	{
+		for (std::vector<std::deque<checkers::absearch::task> >::
+			iterator pos = this->_deques.begin();
+			pos != this->_deques.end(); ++pos)
+		{
+			if (!pos->empty())
+			{
+				task = pos->front();
+				pos->pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void absearch::thread_pool::quit(void)
+	{
+		pthread_mutex_lock(&this->_mutex);
+		this->_quit = true;
+		pthread_cond_broadcast(&this->_cond);
+		pthread_mutex_unlock(&this->_mutex);
+
+		for (std::vector<pthread_t>::const_iterator pos =
+			this->_tids.begin(); pos != this->_tids.end(); ++pos)
+		{
+			pthread_join(*pos, NULL);
+		}
+		for (std::vector<state*>::const_iterator pos =
+			this->_helpers.begin(); pos != this->_helpers.end(); ++pos)
+		{
+			delete *pos;
+		}
+		this->_tids.clear();
+		this->_helpers.clear();
+	}
+
+	// ================================================================
+
+	/**  The new threads are started before the old ones quit, which are
+	 *   kept when they fail to start.
+	 */
+	void absearch::set_threads(unsigned int threads)
+	{
+		threads = std::min(std::max(threads, 1U), absearch::max_threads);
+		if (threads == absearch::_threads)
+		{
+			return;
+		}
+
+		thread_pool* pool = threads > 1 ?
+			new thread_pool(threads - 1) : NULL;
+		delete absearch::_thread_pool;
+		absearch::_thread_pool = pool;
+		absearch::_threads = threads;
+	}
+
+	// ================================================================
+
 	std::string absearch::thinking_detail(unsigned int depth, int val,
 		struct timeval time, long unsigned int nodes,
-		const std::vector<move>& best_moves, bool show_title)
+		const std::vector<packed_move>& best_moves, bool show_title)
 	{
 		std::ostringstream stream;
 
@@ -221,7 +1067,7 @@ namespace checkers
 		stream << ' ' << std::setw(11) << nodes;
 
 		// Print out the moves.
-		for (std::vector<move>::size_type i = 0;
+		for (std::vector<packed_move>::size_type i = 0;
 			i < best_moves.size(); ++i)
 		{
 			if (i > 0 && 0 == i % 6)
@@ -236,32 +1082,59 @@ namespace checkers
 		return stream.str();
 	}
 
+	/**  The fill is the percentage of the slots stored by the search.
+	 *   A record replaced is one stored by the search, and overwritten
+	 *   by a record of another position.
+	 */
+	std::string absearch::hash_detail(const hashtable& hash)
+	{
+		std::ostringstream stream;
+
+		stream << "  hash " << hash.count_used() * 100 / hash.size() <<
+			"% full, " << hash.get_stores() << " stores, " <<
+			hash.get_deep_stores() << " deep, " <<
+			hash.get_replaced() << " replaced\n";
+
+		return stream.str();
+	}
+
 	// ================================================================
 
-	void absearch::optimize_moves(std::vector<move>& moves,
+	void absearch::optimize_moves(std::vector<packed_move>& moves,
 		unsigned int ply)
 	{
-		if (!this->_optimize_move)
+		if (!this->_state._optimize_move)
 		{
 			return;
 		}
-		if (ply >= this->_best_moves.size())
+		if (ply >= this->_state._best_moves.size())
 		{
-			this->_optimize_move = false;
+			this->_state._optimize_move = false;
 			return;
 		}
 
-		std::vector<move>::iterator pos = std::find(moves.begin(),
-			moves.end(), this->_best_moves[ply]);
+		std::vector<packed_move>::iterator pos = std::find(
+			moves.begin(), moves.end(),
+			this->_state._best_moves[ply]);
 		if (moves.end() == pos)
 		{
-			this->_optimize_move = false;
+			this->_state._optimize_move = false;
 			return;
 		}
 
 		std::swap(moves[0], *pos);
 	}
 
+	/**  The static value misses a capture and the end of the game.
+	 */
+	bool absearch::is_quiet(void) const
+	{
+		return !(this->_board.is_black_to_move() ?
+			this->_board.get_black_jumpers() :
+			this->_board.get_white_jumpers()) &&
+			!this->_board.is_losing();
+	}
+
 	/** @param depth
 	 *  @param alpha
 	 *  @param beta
@@ -269,15 +1142,27 @@ namespace checkers
 	 *  @return value found in the hash table.
 	 */ 
 	int absearch::probe_hash(unsigned int depth, int alpha, int beta,
-		std::vector<move>& best_moves) const
+		unsigned int ply, std::vector<packed_move>& best_moves,
+		packed_move& hash_move) const
 	{
-		std::vector<record>::iterator pos = absearch::_hash.begin()
-			+ (this->_board.get_zobrist().key()
-			% absearch::hash_size);
+		const record record = this->_state._table->probe(
+			this->_board.get_zobrist());
 
-		if (pos->get_zobrist() == this->_board.get_zobrist())
+		if (record.get_zobrist() == this->_board.get_zobrist())
 		{
-			return pos->get_val(depth, alpha, beta, best_moves);
+			hash_move = record.get_best_move();
+			const int val = record.get_val(depth, alpha, beta, ply);
+			// The line is only used at the root, see hash_line()
+			if (evaluate::unknown() != val)
+			{
+				best_moves.clear();
+				if (0 == ply)
+				{
+					this->hash_line(best_moves,
+						record.get_depth());
+				}
+			}
+			return val;
 		}
 		/** @retval evaluate::unknown() while an effective value is not
 		 *   found in the hash table.
@@ -285,32 +1170,141 @@ namespace checkers
 		return evaluate::unknown();
 	}
 
+	/**  A value won or lost is saved as from the node, so it is right
+	 *   when the node is probed at another ply, see evaluate::from_root().
+	 */
 	void absearch::record_hash(unsigned int depth, int val,
-		record::hash_flag flag)
+		record::hash_flag flag, unsigned int ply, packed_move best_move)
 	{
-		std::vector<record>::iterator pos = absearch::_hash.begin()
-			+ (this->_board.get_zobrist().key()
-			% absearch::hash_size);
+		this->_state._table->store(record(this->_board.get_zobrist(),
+			depth, evaluate::from_root(val, ply), flag, best_move));
+	}
 
-		*pos = record(this->_board.get_zobrist(), depth, val, flag);
+	packed_move absearch::transposition_cutoff(
+		const std::vector<packed_move>& moves, unsigned int depth,
+		int alpha, int beta, unsigned int ply,
+		std::vector<int>& values) const
+	{
+		for (std::vector<packed_move>::const_iterator pos =
+			moves.begin(); pos != moves.end(); ++pos)
+		{
+			values.push_back(this->probe_child(*pos, depth, alpha,
+				beta, ply));
+			if (values.back() >= beta)
+			{
+				return *pos;
+			}
+		}
+		return packed_move();
 	}
 
-	void absearch::record_hash(unsigned int depth, int val,
-		record::hash_flag flag, const std::vector<move>& best_moves)
+	/**  Only the moves without a capture are looked up, which end the
+	 *   turn, a capture may jump once more.  The child after a
+	 *   reversible move may be a draw whatever the hash table says.
+	 *   The key of the child is computed from the key of the board and
+	 *   the move, see zobrist::change_move().
+	 */
+	int absearch::probe_child(const packed_move& move, unsigned int depth,
+		int alpha, int beta, unsigned int ply) const
 	{
-		std::vector<record>::iterator pos = absearch::_hash.begin()
-			+ (this->_board.get_zobrist().key()
-			% absearch::hash_size);
+		if (move.get_capture())
+		{
+			return evaluate::unknown();
+		}
 
-		*pos = record(this->_board.get_zobrist(), depth, val, flag,
-			best_moves);
+		const zobrist key = this->_board.get_zobrist(move);
+		if (this->_board.is_reversible(move) &&
+			(this->_board.get_reversible_moves() + 1 >=
+			board::REVERSIBLE_MOVES_LIMIT ||
+			this->is_repetition(key)))
+		{
+			return evaluate::unknown();
+		}
+
+		const record record = this->_state._table->probe(key);
+		if (record.get_zobrist() != key)
+		{
+			return evaluate::unknown();
+		}
+
+		const int val = record.get_val(depth - 1, -beta, -alpha,
+			ply + 1);
+		return evaluate::unknown() == val ? val : -val;
+	}
+
+	/**  The buckets are loaded while the moves are searched in turn, or
+	 *   looked up together, instead of one cache miss after another.  A
+	 *   capture may jump once more, the bucket is not of the child then.
+	 */
+	void absearch::prefetch_children(
+		const std::vector<packed_move>& moves) const
+	{
+		for (std::vector<packed_move>::const_iterator pos =
+			moves.begin(); pos != moves.end(); ++pos)
+		{
+			this->_state._table->prefetch(
+				this->_board.get_zobrist(*pos));
+		}
+	}
+
+	/**  A node cut off by the hash table has no best moves, the line
+	 *   ends there.  A record keeps only the first of the best moves,
+	 *   the others are the best moves of the records of the following
+	 *   positions, as far as they are legal and searched.
+	 */
+	void absearch::hash_line(std::vector<packed_move>& best_moves,
+		unsigned int depth) const
+	{
+		board board(this->_board);
+
+		for (std::vector<packed_move>::const_iterator pos =
+			best_moves.begin(); pos != best_moves.end() && depth > 0;
+			++pos)
+		{
+			if (!board.make_move(*pos))
+			{
+				--depth;
+			}
+		}
+
+		while (depth > 0)
+		{
+			const record record = this->_state._table->probe(
+				board.get_zobrist());
+			const packed_move best_move = record.get_best_move();
+			if (record.get_zobrist() != board.get_zobrist() ||
+				packed_move() == best_move)
+			{
+				break;
+			}
+
+			const std::vector<packed_move> legal_moves =
+				board.generate_moves();
+			if (legal_moves.end() == std::find(legal_moves.begin(),
+				legal_moves.end(), best_move))
+			{
+				break;
+			}
+
+			best_moves.push_back(best_move);
+			if (!board.make_move(best_move))
+			{
+				--depth;
+			}
+		}
 	}
 
-	std::vector<move> absearch::_best_moves;
-	bool absearch::_optimize_move = false;
-	long unsigned int absearch::_nodes = 0;
-	struct timeval absearch::_deadline = { 0, 0 };
-	std::vector<record> absearch::_hash(absearch::hash_size);
+	const char absearch::hash_magic[8] = {
+		'P', 'O', 'N', 'D', 'E', 'R', 'H', '4'
+	};
+	std::size_t absearch::_hash_size = absearch::hash_size;
+	std::string absearch::_shared_hash;
+	absearch::state absearch::_engine_state(true);
+	bool absearch::_reductions = true;
+	bool absearch::_futility = true;
+	bool absearch::_etc = true;
+	unsigned int absearch::_threads = 1;
+	absearch::thread_pool* absearch::_thread_pool = NULL;
 }
 
 // End of file
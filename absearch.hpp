@@ -27,66 +27,467 @@
 #ifndef __ABSEARCH_HPP__
 #define __ABSEARCH_HPP__
 
+extern "C"
+{
+	#include <pthread.h>
+}
+#include <deque>
 #include "board.hpp"
-#include "record.hpp"
+#include "hashtable.hpp"
+#include "searchcontext.hpp"
 #include "timeval.hpp"
 
 namespace checkers
 {
 	class absearch
 	{
+	private:
+		class split_point;
+		class thread_pool;
+
 	public:
-		typedef bool (*ponder_t)(void);
-		static bool think(std::vector<move>& best_moves,
-			const board& board, unsigned int depth_limit,
-			time_t second, bool verbose = false);
+		/// The state of a search, one for each searching thread.
+		class state
+		{
+		public:
+			/** @brief Construct a state, which thinks on the helper
+			 *   threads when @e parallel.  One such state thinks at a
+			 *   time.
+			 */
+			explicit state(bool parallel = false);
+
+			/// Get the nodes searched by the last think.
+			inline long unsigned int get_nodes(void) const;
+			/// Get the depth completed by the last think.
+			inline unsigned int get_depth(void) const;
+			/// Get the value of the deepest completed search.
+			inline int get_value(void) const;
+
+			/** @brief Set the zobrist keys of the positions before
+			 *   the one to think on, from the last irreversible
+			 *   move of the game.
+			 */
+			inline void set_history(
+				const std::vector<zobrist>& history);
+
+			/** @brief Save the records of the hash table searched
+			 *   to @e depth at least to the file at @e path.
+			 *  @return The number of the records saved.
+			 */
+			std::size_t save_hash(const std::string& path,
+				unsigned int depth = 0) const;
+			/** @brief Load the records saved by save_hash() into
+			 *   the hash table.
+			 *  @return The number of the records loaded.
+			 */
+			std::size_t load_hash(const std::string& path);
+			/// Share the hash table, see hashtable::share().
+			inline void share_hash(const std::string& name);
+
+		private:
+			friend class absearch;
 
+			/** @brief Construct the state of the helper thread
+			 *   @e index of @e pool, which searches in the hash
+			 *   table of the split point it helps.
+			 */
+			state(thread_pool& pool, unsigned int index);
+
+			/// Define but not implement, to prevent object copy.
+			state(const state& rhs);
+			/// Define but not implement, to prevent object copy.
+			state& operator=(const state& rhs) const;
+
+			/// The limits of the current think.
+			search_context* _context;
+			/// The thread of the state, 0 for the thinking thread.
+			unsigned int _index;
+			/// Whether to think on the helper threads.
+			bool _parallel;
+			/// The helper threads of the current think, if any.
+			thread_pool* _pool;
+			/// The innermost split point searched by the thread.
+			split_point* _split;
+
+			std::vector<packed_move> _best_moves;
+			bool _optimize_move;
+			/// Root moves not to search, which are ranked already.
+			std::vector<packed_move> _excluded_moves;
+
+			long unsigned int _nodes;
+			long unsigned int _total_nodes;
+			unsigned int _depth;
+			int _value;
+
+			hashtable _hash;
+			/// The hash table searched, of the thinking thread.
+			hashtable* _table;
+			/** @brief The zobrist keys of the positions before the
+			 *   searching one, in the game and along the search
+			 *   path.
+			 */
+			std::vector<zobrist> _path;
+		};
+
+		/** @brief Search @e board within the limits of @e context,
+		 *   with the search state of the game engine.
+		 */
+		static bool think(std::vector<packed_move>& best_moves,
+			const board& board, search_context& context,
+			bool verbose = false, unsigned int multipv = 1);
+		/** @overload bool think(std::vector<packed_move>&,
+		 *   const board&, search_context&, bool, unsigned int)
+		 *  @param state The search state of the calling thread.
+		 */
+		static bool think(state& state,
+			std::vector<packed_move>& best_moves,
+			const board& board, search_context& context,
+			bool verbose = false, unsigned int multipv = 1);
+
+		/** @brief Set the game history of the next think, see
+		 *   state::set_history().
+		 */
+		inline static void set_history(
+			const std::vector<zobrist>& history);
+		/// Save the hash table of the game engine, see state::save_hash().
+		inline static std::size_t save_hash(const std::string& path,
+			unsigned int depth = 0);
+		/// Load the hash table of the game engine, see state::load_hash().
+		inline static std::size_t load_hash(const std::string& path);
+		/** @brief Share the hash table of the game engine, and the ones
+		 *   of the states constructed later, in the shared memory
+		 *   segment @e name, see hashtable::share().
+		 */
+		inline static void share_hash(const std::string& name);
+		/** @brief Set the size in megabytes of the hash table of the
+		 *   game engine, and of the ones of the states constructed
+		 *   later.  The records are dropped.
+		 */
+		inline static void set_hash_size(std::size_t megabytes);
+		/// Enable or disable the late move reductions.
+		inline static void set_reductions(bool reductions);
+		/// Enable or disable the futility pruning.
+		inline static void set_futility(bool futility);
+		/// Enable or disable the enhanced transposition cutoffs.
+		inline static void set_etc(bool etc);
+		/** @brief Set the number of the threads of a think, at most
+		 *   absearch::max_threads.  The helper threads are started
+		 *   here, not for each think.
+		 */
+		static void set_threads(unsigned int threads);
+
+		/// The maximal number of the threads of a think.
+		static const unsigned int max_threads = 64;
+		/// The default number of the records of a hash table.
 		static const unsigned int hash_size = 1024 * 1024;
+		/// The first bytes of a file of the hash table.
+		static const char hash_magic[8];
 
 	private:
-		inline explicit absearch(const board& board);
+		/** @brief Pick the moves of a node by stages: the best move in
+		 *   the hash table first, and the other legal moves only when
+		 *   it does not cut off.  Where the children are looked up
+		 *   together, the moves are generated before the hash move.
+		 */
+		class move_picker
+		{
+		public:
+			inline move_picker(absearch& search,
+				packed_move hash_move, unsigned int depth,
+				int beta, unsigned int ply);
+
+			/** @brief Get the next move to search, false when no
+			 *   more.  @e alpha is the alpha of the node by now.
+			 */
+			bool next(packed_move& move, int alpha);
+			/** @brief Get the value after the last move picked from
+			 *   the hash table, see probe_child().  It is at least
+			 *   beta when the child cuts off the node.
+			 */
+			inline int get_value(void) const;
+
+		private:
+			/// Look up the child after @e move in the hash table.
+			int probe(const packed_move& move, int alpha) const;
+
+			enum stage
+			{
+				/// Try the move from the hash table.
+				HASH_MOVE,
+				/// Generate the other legal moves.
+				GENERATE,
+				/// Look up the children in the hash table.
+				CUTOFF,
+				/// Pick the legal moves generated.
+				MOVES
+			};
+
+			absearch& _search;
+			packed_move _hash_move;
+			unsigned int _depth;
+			int _beta;
+			unsigned int _ply;
+			stage _stage;
+			/// Whether to look up the children in the hash table.
+			bool _probe;
+			std::vector<packed_move> _moves;
+			/// The values of the children in the hash table.
+			std::vector<int> _values;
+			std::vector<packed_move>::size_type _index;
+			int _value;
+		};
+
+		/// A move of a split point, to search by any thread.
+		struct task
+		{
+			split_point* split;
+			packed_move move;
+			/// The moves searched before it at the node.
+			unsigned int searched;
+		};
+
+		/** @brief A node whose younger brothers are searched by the
+		 *   idle threads together, after the eldest brother is
+		 *   searched (young brothers wait).
+		 */
+		class split_point
+		{
+		public:
+			split_point(const absearch& search, unsigned int depth,
+				int alpha, int beta, unsigned int ply,
+				int futility, unsigned int tasks);
+			~split_point(void);
+
+			/// Search the move of @e task with @e state.
+			void search(const task& task, state& state);
+			/// Wait until the moves are all searched.
+			void wait(void);
+			/** @brief Whether a move of it, or of a split point
+			 *   above, cuts off, so its moves are not needed.
+			 */
+			inline bool is_cut_off(void) const;
+
+		private:
+			friend class absearch;
+
+			/// Define but not implement, to prevent object copy.
+			split_point(const split_point& rhs);
+			/// Define but not implement, to prevent object copy.
+			split_point& operator=(const split_point& rhs) const;
+
+			board _board;
+			state& _owner;
+			split_point* _parent;
+			unsigned int _depth;
+			int _alpha;
+			int _beta;
+			unsigned int _ply;
+			int _futility;
+			std::vector<zobrist> _path;
+
+			pthread_mutex_t _mutex;
+			pthread_cond_t _cond;
+			/// The tasks not searched yet.
+			unsigned int _unfinished;
+			bool _cut_off;
+			/// Whether a move is not searched, for a stop.
+			bool _stopped;
+			std::vector<packed_move> _best_moves;
+			/// The nodes searched by the other threads.
+			long unsigned int _nodes;
+		};
+
+		/** @brief The helper threads of a think.  Each thread pushes
+		 *   the tasks of its split points to the back of its deque
+		 *   and pops them back, the idle threads steal the tasks from
+		 *   the front of the deques.
+		 */
+		class thread_pool
+		{
+		public:
+			/// Start @e helpers threads to help the thinks.
+			explicit thread_pool(unsigned int helpers);
+			~thread_pool(void);
+
+			/// Whether a helper thread waits for a task.
+			inline bool is_idle(void) const;
+			/// Push @e tasks to the back of the deque of @e state.
+			void push(const state& state,
+				const std::vector<task>& tasks);
+			/** @brief Pop a task of @e split from the back of the
+			 *   deque of @e state.
+			 *  @return false when the tasks are all stolen.
+			 */
+			bool pop(const state& state, const split_point* split,
+				task& task);
+
+		private:
+			/// Define but not implement, to prevent object copy.
+			thread_pool(const thread_pool& rhs);
+			/// Define but not implement, to prevent object copy.
+			thread_pool& operator=(const thread_pool& rhs) const;
+
+			/// The thread routine.
+			static void* worker(void* arg);
+
+			/// Search the stolen tasks with @e state until quit.
+			void run(state& state);
+			/** @brief Steal the task at the front of a deque, with
+			 *   the lock held.
+			 */
+			bool steal(task& task);
+			/// Quit and join the started threads.
+			void quit(void);
+
+			std::vector<state*> _helpers;
+			std::vector<pthread_t> _tids;
+			/// The deques of the tasks, one for each state.
+			std::vector<std::deque<task> > _deques;
+			pthread_mutex_t _mutex;
+			pthread_cond_t _cond;
+			unsigned int _idle;
+			bool _quit;
+		};
+
+		/// Quiet moves ordered after so many moves are reduced.
+		static const unsigned int late_moves = 3;
+		/// The minimal depth to reduce a late move.
+		static const unsigned int reduction_depth = 3;
+		/// The maximal depth to prune a futile move.
+		static const unsigned int futility_depth = 2;
+		/// The margin of the futility pruning for each depth.
+		static const int futility_margin = evaluate::WEIGHT_MAN / 2;
+		/// The minimal depth to look up the children in the hash table.
+		static const unsigned int etc_depth = 2;
+		/// The search context is checked every so many nodes.
+		static const long unsigned int check_nodes = 1 << 12;
+		/// The minimal depth to search the younger brothers together.
+		static const unsigned int split_depth = 4;
+		/// The milliseconds to check the search context while waiting.
+		static const long int wait_milliseconds = 10;
+
+		inline absearch(const board& board, state& state);
 
 		/** @brief Alpha-beta pruning is a search algorithm that
 		 *   reduces the number of nodes that need to be evaluated
 		 *   in the search tree by the minimax algorithm.
 		 *  @note This is recursive function.
 		 */
-		int alpha_beta_search(std::vector<move>& best_moves,
+		int alpha_beta_search(std::vector<packed_move>& best_moves,
 			unsigned int depth,
 			int alpha = -evaluate::infinity(),
 			int beta = evaluate::infinity(),
 			unsigned int ply = 0);
 
+		/** @brief Search @e move at a node, with the window and the
+		 *   pruning of the node.  @e futility is the static value of
+		 *   the node raised by the futility margin, or
+		 *   evaluate::infinity() when it does not prune.
+		 *   @e searched counts the moves searched at the node.
+		 *  @return The value after @e move for the player on move,
+		 *   -evaluate::infinity() when it is pruned, or
+		 *   evaluate::unknown() when stopped.
+		 */
+		int search_move(const packed_move& move, unsigned int depth,
+			int alpha, int beta, unsigned int ply, int futility,
+			unsigned int& searched,
+			std::vector<packed_move>& best_moves);
+		/** @brief Search @e move and the moves left in @e picker at a
+		 *   split point, together with the idle threads.
+		 *  @return The value of the node, at least @e beta when it
+		 *   cuts off, or evaluate::unknown() when stopped.
+		 */
+		int split(move_picker& picker, const packed_move& move,
+			unsigned int depth, int alpha, int beta,
+			unsigned int ply, int futility, unsigned int searched,
+			std::vector<packed_move>& best_moves);
+
+		/// Search the best @e multipv root moves with exact values.
+		static bool think_multipv(state& state,
+			std::vector<packed_move>& best_moves,
+			const board& board, bool verbose,
+			unsigned int multipv);
+
 		/// The detail information of thinking.
 		static std::string thinking_detail(unsigned int depth, int val,
 			struct timeval time, long unsigned int nodes,
-			const std::vector<move>& best_moves, bool show_title);
+			const std::vector<packed_move>& best_moves,
+			bool show_title);
+		/// The fill and the replacement statistics of the hash table.
+		static std::string hash_detail(const hashtable& hash);
 
-		void optimize_moves(std::vector<move>& moves, unsigned int ply);
+		void optimize_moves(std::vector<packed_move>& moves,
+			unsigned int ply);
 
-		inline static void set_timeout(time_t second);
-		inline static bool is_timeout(void);
+		/// Whether the position repeats one on the path.
+		inline bool is_repetition(void) const;
+		/** @brief Whether the position after a reversible move, of
+		 *   zobrist key @e key, repeats one on the path.
+		 */
+		inline bool is_repetition(const zobrist& key) const;
+		/** @brief Whether the player on move neither has to capture
+		 *   nor loses.
+		 */
+		bool is_quiet(void) const;
 
-		/// Get an evaluate value from the hash table.
+		/** @brief Get an evaluate value from the hash table, and the
+		 *   best move of the record even when the value is not
+		 *   suitable.
+		 */
 		int probe_hash(unsigned int depth, int alpha, int beta,
-			std::vector<move>& best_moves) const;
-		/// Store an evaluate record in the hash table.
-		void record_hash(unsigned int depth, int val,
-			record::hash_flag flag);
-		/// Store an evaluate record in the hash table with best moves.
+			unsigned int ply, std::vector<packed_move>& best_moves,
+			packed_move& hash_move) const;
+		/** @brief Store an evaluate record in the hash table, of the
+		 *   node @e ply deep.
+		 */
 		void record_hash(unsigned int depth, int val,
-			record::hash_flag flag,
-			const std::vector<move>& best_moves);
+			record::hash_flag flag, unsigned int ply,
+			packed_move best_move = packed_move());
+		/** @brief Enhanced transposition cutoffs, look up the children
+		 *   in the hash table before searching the moves generated.
+		 *   The @e values of the children looked up are appended.
+		 *  @return A move whose child in the hash table proves a value
+		 *   of at least @e beta, or the null move.
+		 */
+		packed_move transposition_cutoff(
+			const std::vector<packed_move>& moves,
+			unsigned int depth, int alpha, int beta,
+			unsigned int ply, std::vector<int>& values) const;
+		/** @brief Get the value after @e move from the record of the
+		 *   child in the hash table, without making the move.
+		 *  @return The value for the player on move, or
+		 *   evaluate::unknown() while the record is not suitable.
+		 */
+		int probe_child(const packed_move& move, unsigned int depth,
+			int alpha, int beta, unsigned int ply) const;
+		/// Prefetch the buckets of the children after @e moves.
+		void prefetch_children(
+			const std::vector<packed_move>& moves) const;
+		/** @brief Complete @e best_moves by the best moves in the
+		 *   hash table, to @e depth ply.
+		 */
+		void hash_line(std::vector<packed_move>& best_moves,
+			unsigned int depth) const;
 
 		board _board;
+		state& _state;
 
-		static std::vector<move> _best_moves;
-		static bool _optimize_move;
-
-		static long unsigned int _nodes;
-		static struct timeval _deadline;
-
-		static std::vector<record> _hash;
+		/// The number of the records of the hash table of a new state.
+		static std::size_t _hash_size;
+		/// The name of the shared hash table of the new states.
+		static std::string _shared_hash;
+		/// The search state of the game engine.
+		static state _engine_state;
+		/// Whether to reduce the late moves.
+		static bool _reductions;
+		/// Whether to prune the futile moves.
+		static bool _futility;
+		/// Whether to look up the children in the hash table first.
+		static bool _etc;
+		/// The number of the threads of a think.
+		static unsigned int _threads;
+		/// The helper threads, none for one thread.
+		static thread_pool* _thread_pool;
 	};
 }
 
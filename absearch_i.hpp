@@ -27,25 +27,184 @@
 #ifndef __ABSEARCH_I_HPP__
 #define __ABSEARCH_I_HPP__
 
+#include <algorithm>
 #include "evaluate.hpp"
 
 namespace checkers
 {
-	inline absearch::absearch(const board& board) :
-		_board(board)
+	inline long unsigned int absearch::state::get_nodes(void) const
 	{
+		return this->_total_nodes;
+	}
+
+	inline unsigned int absearch::state::get_depth(void) const
+	{
+		return this->_depth;
+	}
+
+	inline int absearch::state::get_value(void) const
+	{
+		return this->_value;
+	}
+
+	inline void absearch::state::set_history(
+		const std::vector<zobrist>& history)
+	{
+		this->_path = history;
+	}
+
+	inline void absearch::state::share_hash(const std::string& name)
+	{
+		this->_hash.share(name);
 	}
 
 	// ================================================================
 
-	inline void absearch::set_timeout(time_t second)
+	inline absearch::move_picker::move_picker(absearch& search,
+		packed_move hash_move, unsigned int depth, int beta,
+		unsigned int ply) :
+		_search(search), _hash_move(hash_move), _depth(depth),
+		_beta(beta), _ply(ply), _stage(HASH_MOVE),
+		_probe(absearch::_etc && ply > 0 && depth >= absearch::etc_depth),
+		_moves(), _values(), _index(0), _value(evaluate::unknown())
 	{
-		absearch::_deadline = timeval::now() + second;
+		if (this->_probe)
+		{
+			this->_stage = GENERATE;
+		}
 	}
 
-	inline bool absearch::is_timeout(void)
+	inline int absearch::move_picker::get_value(void) const
 	{
-		return timeval::now() > absearch::_deadline;
+		return this->_value;
+	}
+
+	// ================================================================
+
+	/**  The flags are set once, and read without the locks.
+	 */
+	inline bool absearch::split_point::is_cut_off(void) const
+	{
+		for (const split_point* split = this; split;
+			split = split->_parent)
+		{
+			if (__atomic_load_n(&split->_cut_off, __ATOMIC_ACQUIRE))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// ================================================================
+
+	inline bool absearch::thread_pool::is_idle(void) const
+	{
+		return __atomic_load_n(&this->_idle, __ATOMIC_RELAXED) > 0;
+	}
+
+	// ================================================================
+
+	inline absearch::absearch(const board& board, state& state) :
+		_board(board), _state(state)
+	{
+	}
+
+	// ================================================================
+
+	inline void absearch::set_history(const std::vector<zobrist>& history)
+	{
+		absearch::_engine_state.set_history(history);
+	}
+
+	inline std::size_t absearch::save_hash(const std::string& path,
+		unsigned int depth)
+	{
+		return absearch::_engine_state.save_hash(path, depth);
+	}
+
+	inline std::size_t absearch::load_hash(const std::string& path)
+	{
+		return absearch::_engine_state.load_hash(path);
+	}
+
+	inline void absearch::share_hash(const std::string& name)
+	{
+		absearch::_engine_state.share_hash(name);
+		absearch::_shared_hash = name;
+	}
+
+	/**  A shared hash table is shared again in the size, which must be
+	 *   the size of the shared memory segment.
+	 */
+	inline void absearch::set_hash_size(std::size_t megabytes)
+	{
+		absearch::_hash_size = megabytes * 1024 * 1024 / sizeof(record)
+			/ 2 * 2;
+		absearch::_engine_state._hash.resize(absearch::_hash_size);
+		if (!absearch::_shared_hash.empty())
+		{
+			absearch::_engine_state.share_hash(absearch::_shared_hash);
+		}
+	}
+
+	inline void absearch::set_reductions(bool reductions)
+	{
+		absearch::_reductions = reductions;
+	}
+
+	inline void absearch::set_futility(bool futility)
+	{
+		absearch::_futility = futility;
+	}
+
+	inline void absearch::set_etc(bool etc)
+	{
+		absearch::_etc = etc;
+	}
+
+	/**  Scan backward only to the last irreversible move, usually a few
+	 *   plies, and only the positions with the same player on move,
+	 *   every other ply.
+	 */
+	inline bool absearch::is_repetition(void) const
+	{
+		const zobrist key = this->_board.get_zobrist();
+		const std::vector<zobrist>::size_type size =
+			this->_state._path.size();
+		const std::vector<zobrist>::size_type plies = std::min(size,
+			static_cast<std::vector<zobrist>::size_type>(
+			this->_board.get_reversible_moves()));
+
+		for (std::vector<zobrist>::size_type i = 2; i <= plies; i += 2)
+		{
+			if (this->_state._path[size - i] == key)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**  The path holds the positions before the current one, which is
+	 *   one ply before the position after the move.
+	 */
+	inline bool absearch::is_repetition(const zobrist& key) const
+	{
+		const std::vector<zobrist>::size_type size =
+			this->_state._path.size();
+		const std::vector<zobrist>::size_type plies = std::min(size + 1,
+			static_cast<std::vector<zobrist>::size_type>(
+			this->_board.get_reversible_moves() + 1));
+
+		for (std::vector<zobrist>::size_type i = 2; i <= plies; i += 2)
+		{
+			if (this->_state._path[size + 1 - i] == key)
+			{
+				return true;
+			}
+		}
+		return false;
 	}
 }
 
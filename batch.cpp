@@ -0,0 +1,147 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file batch.cpp
+ *  @brief Analyze a batch of positions on multiple threads.
+ */
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "absearch.hpp"
+#include "batch.hpp"
+#include "timeval.hpp"
+
+namespace checkers
+{
+	batch::batch(std::istream& is, std::ostream& os, unsigned int depth) :
+		_is(is), _os(os), _depth(depth), _is_mutex(), _os_mutex()
+	{
+		pthread_mutex_init(&this->_is_mutex, NULL);
+		pthread_mutex_init(&this->_os_mutex, NULL);
+	}
+
+	batch::~batch(void)
+	{
+		pthread_mutex_destroy(&this->_os_mutex);
+		pthread_mutex_destroy(&this->_is_mutex);
+	}
+
+	void batch::run(unsigned int threads)
+	{
+		std::vector<pthread_t> tids(threads);
+		std::vector<pthread_t>::size_type i;
+		int error;
+
+		for (i = 0; i < tids.size(); ++i)
+		{
+			if ((error = pthread_create(&tids[i], NULL,
+				&batch::worker, this)) != 0)
+			{
+				/** @throw std::runtime_error when
+				 *   pthread_create() failed.
+				 */
+				throw std::runtime_error(
+					std::string("pthread_create() failed: ")
+					+ std::strerror(error));
+			}
+		}
+		for (i = 0; i < tids.size(); ++i)
+		{
+			pthread_join(tids[i], NULL);
+		}
+	}
+
+	void* batch::worker(void* arg)
+	{
+		batch& batch = *static_cast<class batch*>(arg);
+		absearch::state state;
+		std::string line;
+
+		while (batch.getline(line))
+		{
+			std::ostringstream result;
+
+			try
+			{
+				board board(line);
+				std::vector<packed_move> best_moves;
+				search_context context(batch._depth);
+				struct timeval start = timeval::now();
+				absearch::think(state, best_moves, board,
+					context);
+				struct timeval time = timeval::now() - start;
+
+				result << board << ' ';
+				if (best_moves.empty())
+				{
+					result << '-';
+				}
+				else
+				{
+					result << best_moves.front();
+				}
+				result << ' ' << state.get_value() << ' ' <<
+					state.get_depth() << ' ' <<
+					state.get_nodes() << ' ' <<
+					time.tv_sec << '.' << std::setw(3) <<
+					std::setfill('0') <<
+					(time.tv_usec / 1000) << '\n';
+			}
+			catch (std::logic_error& e)
+			{
+				result << e.what() << '\n';
+			}
+
+			batch.putline(result.str());
+		}
+
+		return NULL;
+	}
+
+	bool batch::getline(std::string& line)
+	{
+		bool good;
+
+		pthread_mutex_lock(&this->_is_mutex);
+		do
+		{
+			good = std::getline(this->_is, line);
+		}
+		while (good && line.empty());
+		pthread_mutex_unlock(&this->_is_mutex);
+
+		return good;
+	}
+
+	void batch::putline(const std::string& line)
+	{
+		pthread_mutex_lock(&this->_os_mutex);
+		this->_os << line << std::flush;
+		pthread_mutex_unlock(&this->_os_mutex);
+	}
+}
+
+// End of file
@@ -0,0 +1,80 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file batch.hpp
+ *  @brief Analyze a batch of positions on multiple threads.
+ */
+
+#ifndef __BATCH_HPP__
+#define __BATCH_HPP__
+
+extern "C"
+{
+	#include <pthread.h>
+}
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace checkers
+{
+	/** @class batch
+	 *  @brief Read positions in FEN, one per line, and search each of
+	 *   them to a fixed depth.  Each thread has its own search state, a
+	 *   line of result is streamed out once a position is finished:
+	 *
+	 *  @verbatim
+	     FEN  best-move  value  depth  nodes  time @endverbatim
+	 */
+	class batch
+	{
+	public:
+		batch(std::istream& is, std::ostream& os, unsigned int depth);
+		~batch(void);
+
+		/// Analyze all the positions on @e threads threads.
+		void run(unsigned int threads);
+
+	private:
+		/// Define but not implement, to prevent object copy.
+		batch(const batch& rhs);
+		/// Define but not implement, to prevent object copy.
+		batch& operator=(const batch& rhs) const;
+
+		/// The thread routine.
+		static void* worker(void* arg);
+
+		/// Get the next position, return false at the end of input.
+		bool getline(std::string& line);
+		/// Write out a line of result.
+		void putline(const std::string& line);
+
+		std::istream& _is;
+		std::ostream& _os;
+		unsigned int _depth;
+		pthread_mutex_t _is_mutex;
+		pthread_mutex_t _os_mutex;
+	};
+}
+
+#endif // __BATCH_HPP__
+// End of file
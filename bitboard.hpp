@@ -80,6 +80,8 @@ namespace checkers
 		unsigned int ntz(void) const;
 		/// Get the Least Significant Bit
 		inline bitboard lsb(void) const;
+		/// Get the 32-bit unsigned integer of the bit pattern.
+		inline uint32_t get_bits(void) const;
 		/// Empty bitboard
 		static const uint32_t EMPTY = 0x0U;
 		/// Black pieces initial position
@@ -39,6 +39,11 @@ namespace checkers
 		return bitboard(this->_bitboard & (-this->_bitboard));
 	}
 
+	inline uint32_t bitboard::get_bits(void) const
+	{
+		return this->_bitboard;
+	}
+
 	inline bitboard bitboard::operator <<(int rhs) const
 	{
 		return bitboard(this->_bitboard << rhs);
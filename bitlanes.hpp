@@ -0,0 +1,118 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file bitlanes.hpp
+ *  @brief Bitboards of a number of game boards, in the lanes of a SIMD
+ *   register.
+ */
+
+#ifndef __BITLANES_HPP__
+#define __BITLANES_HPP__
+
+extern "C"
+{
+	#include <stdint.h>
+#if defined(__AVX512F__) || defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+}
+
+namespace checkers
+{
+	/** @class bitlanes
+	 *  @brief The same operations as class bitboard, on 16 bitboards
+	 *   with AVX-512, 8 bitboards with AVX2, or 8 bitboards one by one
+	 *   without them.  The lanes are also used as 32-bit integers.
+	 */
+	class bitlanes
+	{
+	public:
+#if defined(__AVX512F__)
+		static const unsigned int LANES = 16;
+#else
+		static const unsigned int LANES = 8;
+#endif
+
+		/// Construct with all the lanes set to @e x.
+		explicit inline bitlanes(uint32_t x = 0);
+		/// Load @e LANES 32-bit unsigned integers.
+		explicit inline bitlanes(const uint32_t* p);
+
+		/// Store @e LANES 32-bit unsigned integers.
+		inline void store(uint32_t* p) const;
+
+		/// Count set bits in each lane.
+		inline bitlanes count(void) const;
+
+		/// Logical left shift by @e rhs bit(s).
+		inline bitlanes operator <<(int rhs) const;
+		/// Logical right shift by @e rhs bit(s).
+		inline bitlanes operator >>(int rhs) const;
+		/// Bitwise NOT.
+		inline bitlanes operator ~(void) const;
+
+		friend bitlanes operator |(const bitlanes& lhs,
+			const bitlanes& rhs);
+		friend bitlanes operator &(const bitlanes& lhs,
+			const bitlanes& rhs);
+		friend bitlanes operator +(const bitlanes& lhs,
+			const bitlanes& rhs);
+		friend bitlanes operator -(const bitlanes& lhs,
+			const bitlanes& rhs);
+		friend bitlanes operator *(const bitlanes& lhs,
+			const bitlanes& rhs);
+
+	private:
+#if defined(__AVX512F__)
+		inline bitlanes(__m512i x);
+
+		__m512i _lanes;
+#elif defined(__AVX2__)
+		inline bitlanes(__m256i x);
+
+		__m256i _lanes;
+#else
+		uint32_t _lanes[LANES];
+#endif
+	};
+
+	/// Bitwise OR.
+	inline bitlanes operator |(const bitlanes& lhs, const bitlanes& rhs);
+	/// Bitwise OR.
+	inline bitlanes operator |(const bitlanes& lhs, uint32_t rhs);
+	/// Bitwise AND.
+	inline bitlanes operator &(const bitlanes& lhs, const bitlanes& rhs);
+	/// Bitwise AND.
+	inline bitlanes operator &(const bitlanes& lhs, uint32_t rhs);
+	/// Addition, modulo 2 to the power of 32.
+	inline bitlanes operator +(const bitlanes& lhs, const bitlanes& rhs);
+	/// Subtraction, modulo 2 to the power of 32.
+	inline bitlanes operator -(const bitlanes& lhs, const bitlanes& rhs);
+	/// Multiplication, the lower 32 bits.
+	inline bitlanes operator *(const bitlanes& lhs, const bitlanes& rhs);
+	/// Multiplication, the lower 32 bits.
+	inline bitlanes operator *(const bitlanes& lhs, int rhs);
+}
+
+#include "bitlanes_i.hpp"
+#endif // __BITLANES_HPP__
+// End of file
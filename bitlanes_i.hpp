@@ -0,0 +1,323 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file bitlanes_i.hpp
+ *  @brief Bitboards of a number of game boards, in the lanes of a SIMD
+ *   register.
+ */
+
+#ifndef __BITLANES_I_HPP__
+#define __BITLANES_I_HPP__
+
+namespace checkers
+{
+#if defined(__AVX512F__)
+	inline bitlanes::bitlanes(__m512i x) :
+		_lanes(x)
+	{
+	}
+
+	inline bitlanes::bitlanes(uint32_t x) :
+		_lanes(_mm512_set1_epi32(x))
+	{
+	}
+
+	inline bitlanes::bitlanes(const uint32_t* p) :
+		_lanes(_mm512_loadu_si512(p))
+	{
+	}
+
+	inline void bitlanes::store(uint32_t* p) const
+	{
+		_mm512_storeu_si512(p, this->_lanes);
+	}
+
+	/**  The zero masking form avoids the undefined source operand.
+	 */
+	inline bitlanes bitlanes::operator <<(int rhs) const
+	{
+		return bitlanes(_mm512_maskz_slli_epi32(0xffff, this->_lanes,
+			rhs));
+	}
+
+	/**  The zero masking form avoids the undefined source operand.
+	 */
+	inline bitlanes bitlanes::operator >>(int rhs) const
+	{
+		return bitlanes(_mm512_maskz_srli_epi32(0xffff, this->_lanes,
+			rhs));
+	}
+
+	inline bitlanes bitlanes::operator ~(void) const
+	{
+		return bitlanes(_mm512_xor_si512(this->_lanes,
+			_mm512_set1_epi32(-1)));
+	}
+
+	inline bitlanes operator |(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm512_or_si512(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator &(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm512_and_si512(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator +(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm512_add_epi32(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator -(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm512_sub_epi32(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator *(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm512_mullo_epi32(lhs._lanes, rhs._lanes));
+	}
+#elif defined(__AVX2__)
+	inline bitlanes::bitlanes(__m256i x) :
+		_lanes(x)
+	{
+	}
+
+	inline bitlanes::bitlanes(uint32_t x) :
+		_lanes(_mm256_set1_epi32(x))
+	{
+	}
+
+	inline bitlanes::bitlanes(const uint32_t* p) :
+		_lanes(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)))
+	{
+	}
+
+	inline void bitlanes::store(uint32_t* p) const
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p),
+			this->_lanes);
+	}
+
+	inline bitlanes bitlanes::operator <<(int rhs) const
+	{
+		return bitlanes(_mm256_slli_epi32(this->_lanes, rhs));
+	}
+
+	inline bitlanes bitlanes::operator >>(int rhs) const
+	{
+		return bitlanes(_mm256_srli_epi32(this->_lanes, rhs));
+	}
+
+	inline bitlanes bitlanes::operator ~(void) const
+	{
+		return bitlanes(_mm256_xor_si256(this->_lanes,
+			_mm256_set1_epi32(-1)));
+	}
+
+	inline bitlanes operator |(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm256_or_si256(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator &(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm256_and_si256(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator +(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm256_add_epi32(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator -(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm256_sub_epi32(lhs._lanes, rhs._lanes));
+	}
+
+	inline bitlanes operator *(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		return bitlanes(_mm256_mullo_epi32(lhs._lanes, rhs._lanes));
+	}
+#else
+	inline bitlanes::bitlanes(uint32_t x)
+	{
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			this->_lanes[i] = x;
+		}
+	}
+
+	inline bitlanes::bitlanes(const uint32_t* p)
+	{
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			this->_lanes[i] = p[i];
+		}
+	}
+
+	inline void bitlanes::store(uint32_t* p) const
+	{
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			p[i] = this->_lanes[i];
+		}
+	}
+
+	inline bitlanes bitlanes::operator <<(int rhs) const
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = this->_lanes[i] << rhs;
+		}
+
+		return result;
+	}
+
+	inline bitlanes bitlanes::operator >>(int rhs) const
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = this->_lanes[i] >> rhs;
+		}
+
+		return result;
+	}
+
+	inline bitlanes bitlanes::operator ~(void) const
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = ~this->_lanes[i];
+		}
+
+		return result;
+	}
+
+	inline bitlanes operator |(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = lhs._lanes[i] | rhs._lanes[i];
+		}
+
+		return result;
+	}
+
+	inline bitlanes operator &(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = lhs._lanes[i] & rhs._lanes[i];
+		}
+
+		return result;
+	}
+
+	inline bitlanes operator +(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = lhs._lanes[i] + rhs._lanes[i];
+		}
+
+		return result;
+	}
+
+	inline bitlanes operator -(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = lhs._lanes[i] - rhs._lanes[i];
+		}
+
+		return result;
+	}
+
+	inline bitlanes operator *(const bitlanes& lhs, const bitlanes& rhs)
+	{
+		bitlanes result;
+
+		for (unsigned int i = 0; i < bitlanes::LANES; ++i)
+		{
+			result._lanes[i] = lhs._lanes[i] * rhs._lanes[i];
+		}
+
+		return result;
+	}
+#endif
+
+	inline bitlanes operator |(const bitlanes& lhs, uint32_t rhs)
+	{
+		return lhs | bitlanes(rhs);
+	}
+
+	inline bitlanes operator &(const bitlanes& lhs, uint32_t rhs)
+	{
+		return lhs & bitlanes(rhs);
+	}
+
+	inline bitlanes operator *(const bitlanes& lhs, int rhs)
+	{
+		return lhs * bitlanes(static_cast<uint32_t>(rhs));
+	}
+
+	/**  Use the instruction VPOPCNTD if available, otherwise the same as
+	 *   bitboard::count() in each lane.
+	 */
+	inline bitlanes bitlanes::count(void) const
+	{
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+		return bitlanes(_mm512_popcnt_epi32(this->_lanes));
+#elif defined(__AVX2__) && !defined(__AVX512F__) && \
+	defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+		return bitlanes(_mm256_popcnt_epi32(this->_lanes));
+#else
+		bitlanes x = *this;
+
+		x = x - ((x >> 1) & 0x55555555);
+		x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+		x = (x + (x >> 4)) & 0x0f0f0f0f;
+		x = x + (x >> 8);
+		x = x + (x >> 16);
+		return x & 0x0000003f;
+#endif
+	}
+}
+
+#endif // __BITLANES_I_HPP__
+// End of file
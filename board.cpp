@@ -52,7 +52,7 @@ namespace checkers
 	 */
 	board::board(const std::string& str) :
 		_black_pieces(), _white_pieces(), _kings(), _player(),
-		_zobrist()
+		_zobrist(), _reversible_moves(0)
 	{
 		if (str.empty())
 		{
@@ -92,7 +92,24 @@ namespace checkers
 		player color = board::BLACK;
 		bool is_king = false;
 		unsigned int i = 0;
-		std::string::size_type str_size = str.size();
+		std::string::size_type str_size = str.find(":H");
+		if (std::string::npos == str_size)
+		{
+			str_size = str.size();
+		}
+		else if (str_size + 2 >= str.size() || str.find_first_not_of(
+			"0123456789", str_size + 2) != std::string::npos)
+		{
+			std::ostringstream error;
+			error << "Error (illegal FEN, reversible moves `" <<
+				str.substr(str_size + 2) << "'): " << str;
+			throw std::logic_error(error.str());
+		}
+		else
+		{
+			this->_reversible_moves = std::strtoul(
+				str.c_str() + str_size + 2, NULL, 10);
+		}
 		for (p = 2; p < str_size; ++p)
 		{
 			switch (str[p])
@@ -259,10 +276,60 @@ namespace checkers
 
 	bool board::is_valid_move(const move& move) const
 	{
-		std::vector<class move> legal_moves = this->generate_moves();
+		std::vector<packed_move> legal_moves = this->generate_moves();
+
+		return legal_moves.end() != std::find(legal_moves.begin(),
+			legal_moves.end(), packed_move(move));
+	}
+
+	/**  The source of a capture must be a jumper, otherwise there must
+	 *   be no jumper and the source must be a mover.  The destination
+	 *   must be empty, and the captured piece and the crowning must
+	 *   match the board.  A hash move may be of another position with
+	 *   the same zobrist key, so the destination must also be next to
+	 *   the source, or be the landing square over the captured piece, in
+	 *   a direction the piece moves.
+	 */
+	bool board::is_pseudo_legal(const packed_move& move) const
+	{
+		const bool black = this->is_black_to_move();
+		const bitboard jumpers = black ? this->get_black_jumpers() :
+			this->get_white_jumpers();
+		const bitboard src = move.get_src();
+		const bitboard dest = move.get_dest();
+		const bitboard capture = move.get_capture();
+
+		if (src == dest || !(dest & this->get_unoccupied()) ||
+			bool(capture) != bool(jumpers))
+		{
+			return false;
+		}
+		if (capture)
+		{
+			if (!(src & jumpers) || !(capture & (black ?
+				this->_white_pieces : this->_black_pieces)) ||
+				bool(capture & this->_kings) !=
+				move.will_capture_a_king())
+			{
+				return false;
+			}
+		}
+		else if (!(src & (black ? this->get_black_movers() :
+			this->get_white_movers())))
+		{
+			return false;
+		}
 
-		return legal_moves.end() !=
-			std::find(legal_moves.begin(), legal_moves.end(), move);
+		// A man moves toward its kings row only, a king both ways
+		if (!board::is_step(move, black) && (!(src & this->_kings) ||
+			!board::is_step(move, !black)))
+		{
+			return false;
+		}
+
+		return move.will_crown() == (!(src & this->_kings) &&
+			(black ? bool(dest & bitboard::BLACK_KINGS_ROW) :
+			bool(dest & bitboard::WHITE_KINGS_ROW)));
 	}
 
 	/** @return whether the player has dark pieces move once more.
@@ -497,11 +564,22 @@ namespace checkers
 		 *   turn.  The same player will make move once more.
 		 *  @retval false if the other player will make the next move.
 		 */
+		if (this->is_reversible(move))
+		{
+			++this->_reversible_moves;
+		}
+		else
+		{
+			this->_reversible_moves = 0;
+		}
 		return this->is_black_to_move() ?
 			this->make_black_move(move) :
 			this->make_white_move(move);
 	}
 
+	/**  The reversible moves before an irreversible move are unknown,
+	 *   and counted as none.
+	 */
 	void board::undo_move(const move& move)
 	{
 		if (move.get_dest() & this->_black_pieces)
@@ -513,9 +591,55 @@ namespace checkers
 			this->undo_white_move(move);
 		}
 
+		if (this->is_reversible(move) && this->_reversible_moves > 0)
+		{
+			--this->_reversible_moves;
+		}
+		else
+		{
+			this->_reversible_moves = 0;
+		}
+
 		assert(this->is_valid_move(move));
 	}
 
+	void board::undo_move(const move& move, unsigned int reversible_moves)
+	{
+		this->undo_move(move);
+		this->_reversible_moves = reversible_moves;
+	}
+
+	/**  The masks of the shifts by 3 and 5 keep the squares on the
+	 *   board, as for the movers.
+	 */
+	bitboard board::get_neighbors(const bitboard& squares, bool up)
+	{
+		return up ? (squares << 4) |
+			((squares & bitboard::MASK_L3) << 3) |
+			((squares & bitboard::MASK_L5) << 5) :
+			(squares >> 4) |
+			((squares & bitboard::MASK_R3) >> 3) |
+			((squares & bitboard::MASK_R5) >> 5);
+	}
+
+	/**  The square two rows away in the same column is next to a square
+	 *   next to the source, but not diagonal to it.
+	 */
+	bool board::is_step(const packed_move& move, bool up)
+	{
+		const bitboard src = move.get_src();
+		const bitboard dest = move.get_dest();
+		const bitboard capture = move.get_capture();
+
+		if (!capture)
+		{
+			return dest & board::get_neighbors(src, up);
+		}
+		return (capture & board::get_neighbors(src, up)) &&
+			(dest & board::get_neighbors(capture, up)) &&
+			dest != (up ? src << 8 : src >> 8);
+	}
+
 	bitboard board::get_black_movers(void) const
 	{
 		const bitboard unoccupied = this->get_unoccupied();
@@ -640,9 +764,9 @@ namespace checkers
 		return movers;
 	}
 
-	std::vector<move> board::generate_black_moves(void) const
+	std::vector<packed_move> board::generate_black_moves(void) const
 	{
-		std::vector<move> moves;
+		std::vector<packed_move> moves;
 		moves.reserve(42);
 		bitboard black_movers = this->get_black_movers();
 		bitboard src;
@@ -657,7 +781,7 @@ namespace checkers
 			dest = (src << 4) & unoccupied; 
 			if (dest)
 			{
-				moves.push_back(move(src, dest,
+				moves.push_back(packed_move(src, dest,
 					bitboard(bitboard::EMPTY), false,
 					!(src & this->_kings) &&
 					(dest & bitboard::BLACK_KINGS_ROW)));
@@ -668,7 +792,7 @@ namespace checkers
 				unoccupied;
 			if (dest)
 			{
-				moves.push_back(move(src, dest,
+				moves.push_back(packed_move(src, dest,
 					bitboard(bitboard::EMPTY), false,
 					!(src & this->_kings) &&
 					(dest & bitboard::BLACK_KINGS_ROW)));
@@ -679,7 +803,7 @@ namespace checkers
 				dest = (src >> 4) & unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						bitboard(bitboard::EMPTY),
 						false, false));
 				}
@@ -689,7 +813,7 @@ namespace checkers
 					unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						bitboard(bitboard::EMPTY),
 						false, false));
 				}
@@ -699,9 +823,9 @@ namespace checkers
 		return moves;
 	}
 
-	std::vector<move> board::generate_white_moves(void) const
+	std::vector<packed_move> board::generate_white_moves(void) const
 	{
-		std::vector<move> moves;
+		std::vector<packed_move> moves;
 		moves.reserve(42);
 		bitboard white_movers = this->get_white_movers();
 		bitboard src;
@@ -716,7 +840,7 @@ namespace checkers
 			dest = (src >> 4) & unoccupied; 
 			if (dest)
 			{
-				moves.push_back(move(src, dest,
+				moves.push_back(packed_move(src, dest,
 					bitboard(bitboard::EMPTY), false,
 					!(src & this->_kings) &&
 					(dest & bitboard::WHITE_KINGS_ROW)));
@@ -727,7 +851,7 @@ namespace checkers
 				unoccupied;
 			if (dest)
 			{
-				moves.push_back(move(src, dest,
+				moves.push_back(packed_move(src, dest,
 					bitboard(bitboard::EMPTY), false,
 					!(src & this->_kings) &&
 					(dest & bitboard::WHITE_KINGS_ROW)));
@@ -738,7 +862,7 @@ namespace checkers
 				dest = (src << 4) & unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						bitboard(bitboard::EMPTY),
 						false, false));
 				}
@@ -748,7 +872,7 @@ namespace checkers
 					unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						bitboard(bitboard::EMPTY),
 						false, false));
 				}
@@ -758,9 +882,9 @@ namespace checkers
 		return moves;
 	}
 
-	std::vector<move> board::generate_black_jumps(void) const
+	std::vector<packed_move> board::generate_black_jumps(void) const
 	{
-		std::vector<move> moves;
+		std::vector<packed_move> moves;
 		moves.reserve(42);
 		bitboard black_jumpers = this->get_black_jumpers();
 		bitboard src;
@@ -781,7 +905,7 @@ namespace checkers
 					unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						capture, capture & this->_kings,
 						!(src & this->_kings) && (dest
 						& bitboard::BLACK_KINGS_ROW)));
@@ -796,7 +920,7 @@ namespace checkers
 				dest = (capture << 4) & unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						capture, capture & this->_kings,
 						!(src & this->_kings) && (dest
 						& bitboard::BLACK_KINGS_ROW)));
@@ -814,7 +938,7 @@ namespace checkers
 							>> 5)) & unoccupied;
 					if (dest)
 					{
-						moves.push_back(move(
+						moves.push_back(packed_move(
 							src, dest, capture,
 							capture & this->_kings,
 							false));
@@ -829,7 +953,7 @@ namespace checkers
 					dest = (capture >> 4) & unoccupied;
 					if (dest)
 					{
-						moves.push_back(move(
+						moves.push_back(packed_move(
 							src, dest, capture,
 							capture & this->_kings,
 							false));
@@ -841,9 +965,9 @@ namespace checkers
 		return moves;
 	}
 
-	std::vector<move> board::generate_white_jumps(void) const
+	std::vector<packed_move> board::generate_white_jumps(void) const
 	{
-		std::vector<move> moves;
+		std::vector<packed_move> moves;
 		moves.reserve(42);
 		bitboard white_jumpers = this->get_white_jumpers();
 		bitboard src;
@@ -864,7 +988,7 @@ namespace checkers
 					unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						capture, capture & this->_kings,
 						!(src & this->_kings) && (dest
 						& bitboard::WHITE_KINGS_ROW)));
@@ -879,7 +1003,7 @@ namespace checkers
 				dest = (capture >> 4) & unoccupied;
 				if (dest)
 				{
-					moves.push_back(move(src, dest,
+					moves.push_back(packed_move(src, dest,
 						capture, capture & this->_kings,
 						!(src & this->_kings) && (dest
 						& bitboard::WHITE_KINGS_ROW)));
@@ -897,7 +1021,7 @@ namespace checkers
 							<< 5)) & unoccupied;
 					if (dest)
 					{
-						moves.push_back(move( 
+						moves.push_back(packed_move( 
 							src, dest, capture,
 							capture & this->_kings,
 							false));
@@ -912,7 +1036,7 @@ namespace checkers
 					dest = (capture << 4) & unoccupied;
 					if (dest)
 					{
-						moves.push_back(move(
+						moves.push_back(packed_move(
 							src, dest, capture,
 							capture & this->_kings,
 							false));
@@ -924,7 +1048,7 @@ namespace checkers
 		return moves;
 	}
 
-	std::vector<move> board::generate_moves(void) const
+	std::vector<packed_move> board::generate_moves(void) const
 	{
 		return (this->is_black_to_move()) ?
 			(this->get_black_jumpers() ?
@@ -1037,8 +1161,8 @@ namespace checkers
 			throw std::logic_error("Error (illegal move): " + str);
 		}
 
-		std::vector<move> legal_moves = this->generate_moves();
-		for (std::vector<move>::const_iterator pos =
+		std::vector<packed_move> legal_moves = this->generate_moves();
+		for (std::vector<packed_move>::const_iterator pos =
 			legal_moves.begin(); pos != legal_moves.end(); ++pos)
 		{
 			if (pos->get_src() == squares[0] &&
@@ -1209,6 +1333,11 @@ namespace checkers
 			os << 'K' << a_piece;
 		}
 
+		if (rhs.get_reversible_moves() > 0)
+		{
+			os << ":H" << rhs.get_reversible_moves();
+		}
+
 		return os;
 	}
 }
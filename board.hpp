@@ -28,7 +28,7 @@
 #define __BOARD_HPP__
 
 #include <vector>
-#include "move.hpp"
+#include "packedmove.hpp"
 #include "zobrist.hpp"
 
 namespace checkers
@@ -37,13 +37,25 @@ namespace checkers
 	class board
 	{
 	public:
+		/** @brief A game is a draw after so many reversible moves,
+		 *   40 moves by each player.
+		 */
+		static const unsigned int REVERSIBLE_MOVES_LIMIT = 80;
+
 		/// Default constructor.
 		inline board(void);
 		/// Construct from an user input string.
 		explicit board(const std::string& input);
+		/// Construct from the pieces and the player on move.
+		inline board(bitboard black_pieces, bitboard white_pieces,
+			bitboard kings, bool black_to_move);
 
 		/// Check if move is legal based on current situation
 		bool is_valid_move(const move& move) const;
+		/** @brief Check a move, e.g. from the hash table, against the
+		 *   jumpers or the movers without generating the moves.
+		 */
+		bool is_pseudo_legal(const packed_move& move) const;
 
 		/// Make a move by the player has dark pieces.
 		bool make_black_move(const move& move);
@@ -59,6 +71,17 @@ namespace checkers
 		bool make_move(const move& move);
 		/// Undo one move.
 		void undo_move(const move& move);
+		/** @brief Undo one move, and restore the reversible moves
+		 *   before it.
+		 */
+		void undo_move(const move& move, unsigned int reversible_moves);
+		/** @brief Check whether a move can be reversed, which is a
+		 *   king move without a capture.
+		 */
+		inline bool is_reversible(const move& move) const;
+		/** @overload bool is_reversible(const move&) const
+		 */
+		inline bool is_reversible(const packed_move& move) const;
 
 		/// Get all dark pieces on the game board.
 		inline bitboard get_black_pieces(void) const;
@@ -92,6 +115,14 @@ namespace checkers
 
 		/// Get Zobrist key.
 		inline zobrist get_zobrist(void) const;
+		/** @brief Get the Zobrist key after a move which ends the
+		 *   turn, without making it.
+		 */
+		inline zobrist get_zobrist(const packed_move& move) const;
+		/** @brief Get the number of moves since the last irreversible
+		 *   move.
+		 */
+		inline unsigned int get_reversible_moves(void) const;
 
 		/// Get all dark pieces, which can move.
 		bitboard get_black_movers(void) const;
@@ -107,16 +138,16 @@ namespace checkers
 		bitboard get_white_jumpers(void) const;
 
 		/// Generate all legal moves for dark pieces.
-		std::vector<move> generate_black_moves(void) const;
+		std::vector<packed_move> generate_black_moves(void) const;
 		/// Generate all legal moves for light pieces.
-		std::vector<move> generate_white_moves(void) const;
+		std::vector<packed_move> generate_white_moves(void) const;
 		/// Generate all legal jumps for dark pieces.
-		std::vector<move> generate_black_jumps(void) const;
+		std::vector<packed_move> generate_black_jumps(void) const;
 		/// Generate all legal jumps for light pieces.
-		std::vector<move> generate_white_jumps(void) const;
+		std::vector<packed_move> generate_white_jumps(void) const;
 
 		/// Generate all legal moves based on game board.
-		std::vector<move> generate_moves(void) const;
+		std::vector<packed_move> generate_moves(void) const;
 		/// Parse user move @e.
 		move parse_move(const std::string& str) const;
 
@@ -140,6 +171,15 @@ namespace checkers
 
 		/// Build Zobrist key.
 		zobrist build_zobrist(void);
+		/** @brief Get the squares diagonally next to @e squares, toward
+		 *   the kings row for black when @e up, else for white.
+		 */
+		static bitboard get_neighbors(const bitboard& squares, bool up);
+		/** @brief Whether @e move steps, or jumps over its captured
+		 *   piece, toward the kings row for black when @e up, else for
+		 *   white.
+		 */
+		static bool is_step(const packed_move& move, bool up);
 
 		/// All the dark pieces on the game board.
 		bitboard _black_pieces;
@@ -153,6 +193,8 @@ namespace checkers
 		player _player;
 		/// The Zobrist key
 		zobrist _zobrist;
+		/// The moves since the last man move or capture
+		unsigned int _reversible_moves;
 	};
 
 	/// Stream out the current game board.
@@ -35,11 +35,35 @@ namespace checkers
 	inline board::board(void) :
 		_black_pieces(bitboard::BLACK_PIECES_INIT),
 		_white_pieces(bitboard::WHITE_PIECES_INIT),
-		_kings(bitboard::EMPTY), _player(board::BLACK), _zobrist(0x0UL)
+		_kings(bitboard::EMPTY), _player(board::BLACK), _zobrist(0x0UL),
+		_reversible_moves(0)
 	{
 		this->_zobrist = this->build_zobrist();
 	}
 
+	inline board::board(bitboard black_pieces, bitboard white_pieces,
+		bitboard kings, bool black_to_move) :
+		_black_pieces(black_pieces), _white_pieces(white_pieces),
+		_kings(kings),
+		_player(black_to_move ? board::BLACK : board::WHITE),
+		_zobrist(0x0UL), _reversible_moves(0)
+	{
+		this->_zobrist = this->build_zobrist();
+	}
+
+	/**  A man never moves backward and a captured piece never comes
+	 *   back, so no position before a man move or a capture repeats.
+	 */
+	inline bool board::is_reversible(const move& move) const
+	{
+		return !move.get_capture() && (move.get_src() & this->_kings);
+	}
+
+	inline bool board::is_reversible(const packed_move& move) const
+	{
+		return !move.get_capture() && (move.get_src() & this->_kings);
+	}
+
 	inline bitboard board::get_black_pieces(void) const
 	{
 		return this->_black_pieces;
@@ -105,6 +129,20 @@ namespace checkers
 	{
 		return this->_zobrist;
 	} 
+
+	inline zobrist board::get_zobrist(const packed_move& move) const
+	{
+		zobrist zobrist = this->_zobrist;
+
+		zobrist.change_move(move, this->is_black_to_move(),
+			this->_kings & move.get_src());
+		return zobrist;
+	}
+
+	inline unsigned int board::get_reversible_moves(void) const
+	{
+		return this->_reversible_moves;
+	}
 }
 
 #endif // __BOARD_I_HPP__
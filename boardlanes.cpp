@@ -0,0 +1,66 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file boardlanes.cpp
+ *  @brief Game boards in the lanes of SIMD registers.
+ */
+
+#include "boardlanes.hpp"
+
+namespace checkers
+{
+	void boardlanes::classify(const packed_board* boards,
+		classification* classes, std::size_t size)
+	{
+		uint32_t mobility[bitlanes::LANES];
+		uint32_t jumpers[bitlanes::LANES];
+		uint32_t movers[bitlanes::LANES];
+		std::size_t i;
+		std::size_t j;
+
+		for (i = 0; i < size; i += bitlanes::LANES)
+		{
+			const boardlanes lanes(boards + i, size - i);
+			const bitlanes black = lanes.get_black_to_move();
+
+			((black & lanes.count_black_moves()) |
+				(~black & lanes.count_white_moves())).store(
+				mobility);
+			((black & lanes.get_black_jumpers()) |
+				(~black & lanes.get_white_jumpers())).store(
+				jumpers);
+			((black & lanes.get_black_movers()) |
+				(~black & lanes.get_white_movers())).store(
+				movers);
+
+			for (j = 0; j < bitlanes::LANES && i + j < size; ++j)
+			{
+				classes[i + j].mobility = mobility[j];
+				classes[i + j].forced_capture = jumpers[j];
+				classes[i + j].terminal =
+					!(jumpers[j] || movers[j]);
+			}
+		}
+	}
+}
+
+// End of file
@@ -0,0 +1,119 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file boardlanes.hpp
+ *  @brief Game boards in the lanes of SIMD registers.
+ */
+
+#ifndef __BOARDLANES_HPP__
+#define __BOARDLANES_HPP__
+
+#include <cstddef>
+#include "bitlanes.hpp"
+#include "packedboard.hpp"
+
+namespace checkers
+{
+	/** @class boardlanes
+	 *  @brief The same shift-and-mask operations as class board, on
+	 *   bitlanes::LANES game boards at once.
+	 */
+	class boardlanes
+	{
+	public:
+		/** @brief Load @e size game boards, at most bitlanes::LANES.
+		 *   The rest of the lanes are empty game boards.
+		 */
+		inline boardlanes(const packed_board* boards, std::size_t size);
+
+		/// The classification of a game board.
+		struct classification
+		{
+			/// The number of moves without a capture.
+			unsigned int mobility;
+			/// Whether the player on move has to capture.
+			bool forced_capture;
+			/// Whether the player on move has no legal move.
+			bool terminal;
+		};
+
+		/** @brief Classify @e size game boards for the player on move,
+		 *   bitlanes::LANES game boards at once.
+		 */
+		static void classify(const packed_board* boards,
+			classification* classes, std::size_t size);
+
+		/// Get all dark pieces on the game boards.
+		inline bitlanes get_black_pieces(void) const;
+		/// Get all light pieces on the game boards.
+		inline bitlanes get_white_pieces(void) const;
+		/// Get all kings on the game boards.
+		inline bitlanes get_kings(void) const;
+		/// Get all unoccupied squares on the game boards.
+		inline bitlanes get_unoccupied(void) const;
+		/// Get all dark men on the game boards.
+		inline bitlanes get_black_men(void) const;
+		/// Get all light men on the game boards.
+		inline bitlanes get_white_men(void) const;
+		/// Get all dark kings on the game boards.
+		inline bitlanes get_black_kings(void) const;
+		/// Get all light kings on the game boards.
+		inline bitlanes get_white_kings(void) const;
+		/** @brief Get 1 where the player has dark pieces will make the
+		 *   next move, otherwise -1.
+		 */
+		inline bitlanes get_signs(void) const;
+		/** @brief Get all ones where the player has dark pieces will
+		 *   make the next move, otherwise 0.
+		 */
+		inline bitlanes get_black_to_move(void) const;
+
+		/// Get all dark pieces, which can move.
+		inline bitlanes get_black_movers(void) const;
+		/// Get all light pieces, which can move.
+		inline bitlanes get_white_movers(void) const;
+		/** @brief Get all dark pieces, which can jump and capture an
+		 *   enemy piece.
+		 */
+		inline bitlanes get_black_jumpers(void) const;
+		/** @brief Get all light pieces, which can jump and capture an
+		 *   enemy piece.
+		 */
+		inline bitlanes get_white_jumpers(void) const;
+
+		/// Count the moves without a capture of the dark pieces.
+		inline bitlanes count_black_moves(void) const;
+		/// Count the moves without a capture of the light pieces.
+		inline bitlanes count_white_moves(void) const;
+
+	private:
+		bitlanes _black_pieces;
+		bitlanes _white_pieces;
+		bitlanes _kings;
+		bitlanes _signs;
+		bitlanes _black_to_move;
+	};
+}
+
+#include "boardlanes_i.hpp"
+#endif // __BOARDLANES_HPP__
+// End of file
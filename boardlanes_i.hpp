@@ -0,0 +1,234 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file boardlanes_i.hpp
+ *  @brief Game boards in the lanes of SIMD registers.
+ */
+
+#ifndef __BOARDLANES_I_HPP__
+#define __BOARDLANES_I_HPP__
+
+namespace checkers
+{
+	inline boardlanes::boardlanes(const packed_board* boards,
+		std::size_t size)
+	{
+		uint32_t black_pieces[bitlanes::LANES] = { 0 };
+		uint32_t white_pieces[bitlanes::LANES] = { 0 };
+		uint32_t kings[bitlanes::LANES] = { 0 };
+		uint32_t signs[bitlanes::LANES] = { 0 };
+		uint32_t black_to_move[bitlanes::LANES] = { 0 };
+		std::size_t i;
+
+		for (i = 0; i < size && i < bitlanes::LANES; ++i)
+		{
+			black_pieces[i] = boards[i].black_pieces;
+			white_pieces[i] = boards[i].white_pieces;
+			kings[i] = boards[i].kings;
+			signs[i] = boards[i].black_to_move ? 1 : -1;
+			black_to_move[i] = boards[i].black_to_move ? -1 : 0;
+		}
+
+		this->_black_pieces = bitlanes(black_pieces);
+		this->_white_pieces = bitlanes(white_pieces);
+		this->_kings = bitlanes(kings);
+		this->_signs = bitlanes(signs);
+		this->_black_to_move = bitlanes(black_to_move);
+	}
+
+	inline bitlanes boardlanes::get_black_pieces(void) const
+	{
+		return this->_black_pieces;
+	}
+
+	inline bitlanes boardlanes::get_white_pieces(void) const
+	{
+		return this->_white_pieces;
+	}
+
+	inline bitlanes boardlanes::get_kings(void) const
+	{
+		return this->_kings;
+	}
+
+	inline bitlanes boardlanes::get_unoccupied(void) const
+	{
+		return ~(this->_black_pieces | this->_white_pieces);
+	}
+
+	inline bitlanes boardlanes::get_black_men(void) const
+	{
+		return this->_black_pieces & ~this->_kings;
+	}
+
+	inline bitlanes boardlanes::get_white_men(void) const
+	{
+		return this->_white_pieces & ~this->_kings;
+	}
+
+	inline bitlanes boardlanes::get_black_kings(void) const
+	{
+		return this->_black_pieces & this->_kings;
+	}
+
+	inline bitlanes boardlanes::get_white_kings(void) const
+	{
+		return this->_white_pieces & this->_kings;
+	}
+
+	inline bitlanes boardlanes::get_signs(void) const
+	{
+		return this->_signs;
+	}
+
+	inline bitlanes boardlanes::get_black_to_move(void) const
+	{
+		return this->_black_to_move;
+	}
+
+	/**  The same as board::get_black_movers(), without the branch for no
+	 *   kings.
+	 */
+	inline bitlanes boardlanes::get_black_movers(void) const
+	{
+		const bitlanes unoccupied = this->get_unoccupied();
+		const bitlanes black_kings = this->get_black_kings();
+
+		return (((unoccupied >> 4) |
+			((unoccupied & bitboard::MASK_R3) >> 3) |
+			((unoccupied & bitboard::MASK_R5) >> 5)) &
+			this->_black_pieces) |
+			(((unoccupied << 4) |
+			((unoccupied & bitboard::MASK_L3) << 3) |
+			((unoccupied & bitboard::MASK_L5) << 5)) &
+			black_kings);
+	}
+
+	/**  The same as board::get_white_movers(), without the branch for no
+	 *   kings.
+	 */
+	inline bitlanes boardlanes::get_white_movers(void) const
+	{
+		const bitlanes unoccupied = this->get_unoccupied();
+		const bitlanes white_kings = this->get_white_kings();
+
+		return (((unoccupied << 4) |
+			((unoccupied & bitboard::MASK_L3) << 3) |
+			((unoccupied & bitboard::MASK_L5) << 5)) &
+			this->_white_pieces) |
+			(((unoccupied >> 4) |
+			((unoccupied & bitboard::MASK_R3) >> 3) |
+			((unoccupied & bitboard::MASK_R5) >> 5)) &
+			white_kings);
+	}
+
+	/**  The same as board::get_black_jumpers(), without the branches.
+	 */
+	inline bitlanes boardlanes::get_black_jumpers(void) const
+	{
+		const bitlanes unoccupied = this->get_unoccupied();
+		const bitlanes black_kings = this->get_black_kings();
+		// White pieces next to not occupied squares
+		bitlanes temp = (unoccupied >> 4) & this->_white_pieces;
+		bitlanes movers = (((temp & bitboard::MASK_R3) >> 3) |
+			((temp & bitboard::MASK_R5) >> 5)) &
+			this->_black_pieces;
+		temp = (((unoccupied & bitboard::MASK_R3) >> 3) |
+			((unoccupied & bitboard::MASK_R5) >> 5)) &
+			this->_white_pieces;
+		movers = movers | ((temp >> 4) & this->_black_pieces);
+
+		temp = (unoccupied << 4) & this->_white_pieces;
+		movers = movers | ((((temp & bitboard::MASK_L3) << 3) |
+			((temp & bitboard::MASK_L5) << 5)) & black_kings);
+		temp = (((unoccupied & bitboard::MASK_L3) << 3) |
+			((unoccupied & bitboard::MASK_L5) << 5)) &
+			this->_white_pieces;
+		return movers | ((temp << 4) & black_kings);
+	}
+
+	/**  The same as board::get_white_jumpers(), without the branches.
+	 */
+	inline bitlanes boardlanes::get_white_jumpers(void) const
+	{
+		const bitlanes unoccupied = this->get_unoccupied();
+		const bitlanes white_kings = this->get_white_kings();
+		// Black pieces next to not occupied squares
+		bitlanes temp = (unoccupied << 4) & this->_black_pieces;
+		bitlanes movers = (((temp & bitboard::MASK_L3) << 3) |
+			((temp & bitboard::MASK_L5) << 5)) &
+			this->_white_pieces;
+		temp = (((unoccupied & bitboard::MASK_L3) << 3) |
+			((unoccupied & bitboard::MASK_L5) << 5)) &
+			this->_black_pieces;
+		movers = movers | ((temp << 4) & this->_white_pieces);
+
+		temp = (unoccupied >> 4) & this->_black_pieces;
+		movers = movers | ((((temp & bitboard::MASK_R3) >> 3) |
+			((temp & bitboard::MASK_R5) >> 5)) & white_kings);
+		temp = (((unoccupied & bitboard::MASK_R3) >> 3) |
+			((unoccupied & bitboard::MASK_R5) >> 5)) &
+			this->_black_pieces;
+		return movers | ((temp >> 4) & white_kings);
+	}
+
+	/**  Each direction of each piece is one move.
+	 */
+	inline bitlanes boardlanes::count_black_moves(void) const
+	{
+		const bitlanes unoccupied = this->get_unoccupied();
+		const bitlanes black_kings = this->get_black_kings();
+
+		return ((unoccupied >> 4) & this->_black_pieces).count() +
+			(((unoccupied & bitboard::MASK_R3) >> 3) &
+			this->_black_pieces).count() +
+			(((unoccupied & bitboard::MASK_R5) >> 5) &
+			this->_black_pieces).count() +
+			((unoccupied << 4) & black_kings).count() +
+			(((unoccupied & bitboard::MASK_L3) << 3) &
+			black_kings).count() +
+			(((unoccupied & bitboard::MASK_L5) << 5) &
+			black_kings).count();
+	}
+
+	/**  Each direction of each piece is one move.
+	 */
+	inline bitlanes boardlanes::count_white_moves(void) const
+	{
+		const bitlanes unoccupied = this->get_unoccupied();
+		const bitlanes white_kings = this->get_white_kings();
+
+		return ((unoccupied << 4) & this->_white_pieces).count() +
+			(((unoccupied & bitboard::MASK_L3) << 3) &
+			this->_white_pieces).count() +
+			(((unoccupied & bitboard::MASK_L5) << 5) &
+			this->_white_pieces).count() +
+			((unoccupied >> 4) & white_kings).count() +
+			(((unoccupied & bitboard::MASK_R3) >> 3) &
+			white_kings).count() +
+			(((unoccupied & bitboard::MASK_R5) >> 5) &
+			white_kings).count();
+	}
+}
+
+#endif // __BOARDLANES_I_HPP__
+// End of file
@@ -0,0 +1,146 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file endgame.cpp
+ *  @brief Artificial intelligence, evaluate the endgames by the material.
+ */
+
+#include "endgame.hpp"
+
+namespace checkers
+{
+	/**  The numbers of the pieces are constants in an evaluator, so the
+	 *   terms of another signature are folded away by the compiler.  A
+	 *   man is valued half a king, as the compile time weights.
+	 */
+	template <unsigned int SIGNATURE>
+	int endgame::evaluate_signature(uint32_t own_kings, uint32_t opp_kings)
+	{
+		const unsigned int mask = (1 << endgame::BITS) - 1;
+		const int own_men = SIGNATURE >> 3 * endgame::BITS & mask;
+		const int own_king_count = SIGNATURE >> 2 * endgame::BITS & mask;
+		const int opp_men = SIGNATURE >> endgame::BITS & mask;
+		const int opp_king_count = SIGNATURE & mask;
+		const int material = own_men + 2 * own_king_count -
+			opp_men - 2 * opp_king_count;
+		const int traded = 4 * endgame::MAX_PIECES -
+			(own_men + own_king_count + opp_men + opp_king_count);
+		int val = (material > 0 ? traded : material < 0 ? -traded : 0) *
+			endgame::TRADE;
+
+		if (0 == own_men && 0 == opp_men && own_king_count &&
+			opp_king_count)
+		{
+			if (own_king_count > opp_king_count)
+			{
+				val += endgame::drive(own_kings, opp_kings);
+			}
+			else if (own_king_count < opp_king_count)
+			{
+				val -= endgame::drive(opp_kings, own_kings);
+			}
+		}
+
+		return val;
+	}
+
+	template <unsigned int SIGNATURE>
+	void endgame::builder<SIGNATURE>::build(std::vector<evaluator>& table)
+	{
+		table[SIGNATURE - 1] = &endgame::evaluate_signature<SIGNATURE - 1>;
+		endgame::builder<SIGNATURE - 1>::build(table);
+	}
+
+	template <>
+	void endgame::builder<0>::build(std::vector<evaluator>& table)
+	{
+		// Void the warning: unused parameter ‘table’
+		(void)table;
+	}
+
+	const std::vector<endgame::evaluator> endgame::_table(
+		endgame::build_table());
+	const std::vector<int> endgame::_corners(endgame::build_corners());
+
+	/**  The signature is the numbers of the men and the kings of the
+	 *   player on move, then of the opponent, in endgame::BITS each.
+	 */
+	int endgame::evaluate(uint32_t black_pieces, uint32_t white_pieces,
+		uint32_t kings, bool black_to_move)
+	{
+		if (bitboard(black_pieces | white_pieces).count() >
+			4 * endgame::MAX_PIECES)
+		{
+			return 0;
+		}
+
+		const uint32_t own = black_to_move ? black_pieces : white_pieces;
+		const uint32_t opp = black_to_move ? white_pieces : black_pieces;
+		const unsigned int own_men = bitboard(own & ~kings).count();
+		const unsigned int own_kings = bitboard(own & kings).count();
+		const unsigned int opp_men = bitboard(opp & ~kings).count();
+		const unsigned int opp_kings = bitboard(opp & kings).count();
+
+		if (own_men > endgame::MAX_PIECES ||
+			own_kings > endgame::MAX_PIECES ||
+			opp_men > endgame::MAX_PIECES ||
+			opp_kings > endgame::MAX_PIECES)
+		{
+			return 0;
+		}
+
+		return endgame::_table[own_men << 3 * endgame::BITS |
+			own_kings << 2 * endgame::BITS |
+			opp_men << endgame::BITS | opp_kings](own & kings,
+			opp & kings);
+	}
+
+	std::vector<endgame::evaluator> endgame::build_table(void)
+	{
+		std::vector<evaluator> table(endgame::SIGNATURES);
+
+		endgame::builder<endgame::SIGNATURES>::build(table);
+		return table;
+	}
+
+	std::vector<int> endgame::build_corners(void)
+	{
+		std::vector<int> corners(32);
+		unsigned int i;
+
+		for (i = 0; i < corners.size(); ++i)
+		{
+			corners[i] = 32;
+			for (bitboard corner(endgame::DOUBLE_CORNERS); corner;
+				corner ^= corner.lsb())
+			{
+				int steps = endgame::distance(i, corner.ntz());
+
+				corners[i] = steps < corners[i] ? steps : corners[i];
+			}
+		}
+
+		return corners;
+	}
+}
+
+// End of file
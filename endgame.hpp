@@ -0,0 +1,112 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file endgame.hpp
+ *  @brief Artificial intelligence, evaluate the endgames by the material.
+ */
+
+#ifndef __ENDGAME_HPP__
+#define __ENDGAME_HPP__
+
+extern "C"
+{
+	#include <stdint.h>
+}
+#include <vector>
+#include "board.hpp"
+
+namespace checkers
+{
+	/** @class endgame
+	 *  @brief The material signature of a game board with few pieces,
+	 *   the numbers of the men and the kings of the player on move and
+	 *   of the opponent, indexes a table of the evaluators specialized
+	 *   at compile time for the signature.
+	 *
+	 *   The side ahead in material is rewarded for trading down.  With
+	 *   kings only, the side with more kings is rewarded for driving the
+	 *   fewer kings out of the double corners, and for closing in.
+	 */
+	class endgame
+	{
+	public:
+		/** @brief Get the value of the endgame for the player on
+		 *   move, 0 when the game board is not an endgame.
+		 */
+		inline static int evaluate(const board& board);
+		/** @overload int evaluate(const board&)
+		 */
+		static int evaluate(uint32_t black_pieces,
+			uint32_t white_pieces, uint32_t kings,
+			bool black_to_move);
+
+		/// The most men, or kings, of a side in an endgame.
+		static const unsigned int MAX_PIECES = 3;
+		/// The value of a piece traded off when ahead in material.
+		static const int TRADE  = 8;
+		/// The value of a step of the fewer kings from a double corner.
+		static const int CORNER = 8;
+		/// The value of a step of the more kings to the fewer kings.
+		static const int CLOSE  = 4;
+
+	private:
+		/// An evaluator of the kings of a signature.
+		typedef int (*evaluator)(uint32_t own_kings, uint32_t opp_kings);
+		/// Fill the table with the evaluators below @e SIGNATURE.
+		template <unsigned int SIGNATURE>
+		struct builder
+		{
+			static void build(std::vector<evaluator>& table);
+		};
+
+		/** @brief Evaluate the kings of the player on move and of the
+		 *   opponent, with the numbers of the pieces of @e SIGNATURE.
+		 */
+		template <unsigned int SIGNATURE>
+		static int evaluate_signature(uint32_t own_kings,
+			uint32_t opp_kings);
+		/// Get the sum of the values of the kings.
+		inline static int drive(uint32_t more_kings, uint32_t fewer_kings);
+		/// Get the number of the king moves between the squares.
+		inline static int distance(unsigned int from, unsigned int to);
+
+		/// Build the table of the evaluators.
+		static std::vector<evaluator> build_table(void);
+		/// Build the distances of the squares to the double corners.
+		static std::vector<int> build_corners(void);
+
+		/// The bits of a number of pieces in a signature.
+		static const unsigned int BITS = 2;
+		/// The number of signatures.
+		static const unsigned int SIGNATURES = 1 << 4 * BITS;
+		/// The squares of the double corners.
+		static const uint32_t DOUBLE_CORNERS =
+			0x1U <<  0 | 0x1U <<  4 | 0x1U << 27 | 0x1U << 31;
+
+		static const std::vector<evaluator> _table;
+		static const std::vector<int> _corners;
+	};
+}
+
+#include "endgame_i.hpp"
+#endif // __ENDGAME_HPP__
+// End of file
@@ -0,0 +1,79 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file endgame_i.hpp
+ *  @brief Artificial intelligence, evaluate the endgames by the material.
+ */
+
+#ifndef __ENDGAME_I_HPP__
+#define __ENDGAME_I_HPP__
+
+#include "bitboard.hpp"
+
+namespace checkers
+{
+	inline int endgame::evaluate(const board& board)
+	{
+		return endgame::evaluate(board.get_black_pieces().get_bits(),
+			board.get_white_pieces().get_bits(),
+			board.get_kings().get_bits(), board.is_black_to_move());
+	}
+
+	/**  The fewer kings are safe in a double corner, and the more kings
+	 *   have to come close to drive them out.
+	 */
+	inline int endgame::drive(uint32_t more_kings, uint32_t fewer_kings)
+	{
+		int val = 0;
+
+		for (bitboard fewer(fewer_kings); fewer; fewer ^= fewer.lsb())
+		{
+			unsigned int to = fewer.ntz();
+
+			val += endgame::CORNER * endgame::_corners[to];
+			for (bitboard more(more_kings); more; more ^= more.lsb())
+			{
+				val -= endgame::CLOSE *
+					endgame::distance(more.ntz(), to);
+			}
+		}
+
+		return val;
+	}
+
+	/**  A king moves one step along a diagonal, so the distance is the
+	 *   larger of the distances of the rows and of the columns.
+	 */
+	inline int endgame::distance(unsigned int from, unsigned int to)
+	{
+		int rows = static_cast<int>(from >> 2) - static_cast<int>(to >> 2);
+		int cols = static_cast<int>(2 * (3 - (from & 3)) + (from >> 2 & 1))
+			- static_cast<int>(2 * (3 - (to & 3)) + (to >> 2 & 1));
+
+		rows = rows < 0 ? -rows : rows;
+		cols = cols < 0 ? -cols : cols;
+		return rows > cols ? rows : cols;
+	}
+}
+
+#endif // __ENDGAME_I_HPP__
+// End of file
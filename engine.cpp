@@ -28,38 +28,57 @@ extern "C"
 {
 	#include <unistd.h>
 }
+#include <algorithm>
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
 #include "absearch.hpp"
+#include "boardlanes.hpp"
 #include "engine.hpp"
 #include "nonstdio.hpp"
+#include "packedboard.hpp"
+#include "timeval.hpp"
 
 namespace checkers
 {
 	engine::engine(void) :
-		_board(), _rotate(false), _history(), _best_moves(),
-		_force_mode(false), _depth_limit(UNLIMITED), _time_limit(10),
-		_verbose(false)
+		_board(), _rotate(false), _history(), _reversible_moves(),
+		_best_moves(), _force_mode(false), _depth_limit(UNLIMITED),
+		_time_limit(10), _node_limit(0), _multipv(1), _verbose(false),
+		_ponder(true), _ponder_moves(), _ponder_context(NULL)
 	{
 		this->_action.insert(std::make_pair("?",
 			&engine::do_help));
 		this->_action.insert(std::make_pair("analyze",
 			&engine::do_analyze));
+		this->_action.insert(std::make_pair("bench",
+			&engine::do_bench));
 		this->_action.insert(std::make_pair("black",
 			&engine::do_black));
+		this->_action.insert(std::make_pair("classify",
+			&engine::do_classify));
+		this->_action.insert(std::make_pair("evalbatch",
+			&engine::do_evalbatch));
 		this->_action.insert(std::make_pair("force",
 			&engine::do_force));
 		this->_action.insert(std::make_pair("go",
 			&engine::do_go));
+		this->_action.insert(std::make_pair("hash",
+			&engine::do_hash));
 		this->_action.insert(std::make_pair("help",
 			&engine::do_help));
 		this->_action.insert(std::make_pair("history",
 			&engine::do_history));
+		this->_action.insert(std::make_pair("multipv",
+			&engine::do_multipv));
 		this->_action.insert(std::make_pair("new",
 			&engine::do_new));
 		this->_action.insert(std::make_pair("ping",
 			&engine::do_ping));
 		this->_action.insert(std::make_pair("ponder",
-			&engine::not_implemented));
+			&engine::do_ponder));
 		this->_action.insert(std::make_pair("print",
 			&engine::do_print));
 		this->_action.insert(std::make_pair("quit",
@@ -68,14 +87,20 @@ namespace checkers
 			&engine::do_rotate));
 		this->_action.insert(std::make_pair("sd",
 			&engine::do_sd));
+		this->_action.insert(std::make_pair("sn",
+			&engine::do_sn));
 		this->_action.insert(std::make_pair("st",
 			&engine::do_st));
 		this->_action.insert(std::make_pair("setboard",
 			&engine::do_setboard));
+		this->_action.insert(std::make_pair("setoption",
+			&engine::do_setoption));
 		this->_action.insert(std::make_pair("undo",
 			&engine::do_undo));
 		this->_action.insert(std::make_pair("verbose",
 			&engine::do_verbose));
+		this->_action.insert(std::make_pair("weights",
+			&engine::do_weights));
 		this->_action.insert(std::make_pair("white",
 			&engine::do_white));
 	}
@@ -309,12 +334,14 @@ namespace checkers
 	bool engine::make_move(const move& move)
 	{
 		this->_history.push_back(move);
+		this->_reversible_moves.push_back(
+			this->_board.get_reversible_moves());
 
 		bool ret = this->_board.make_move(move);
 
 		if (this->_best_moves.size())
 		{
-			if (move == this->_best_moves.front())
+			if (packed_move(move) == this->_best_moves.front())
 			{
 				this->_best_moves.erase(
 					this->_best_moves.begin());
@@ -328,7 +355,35 @@ namespace checkers
 		return ret;
 	}
 
-	void engine::computer_makes_move(void)
+	/**  Undo the moves on a copy of the board back to the last
+	 *   irreversible move, no position before it can repeat.
+	 *  @return The keys in the order of the game.
+	 */
+	std::vector<zobrist> engine::reversible_history(void) const
+	{
+		std::vector<zobrist> history;
+		board board = this->_board;
+
+		for (std::vector<move>::const_reverse_iterator pos =
+			this->_history.rbegin(); pos != this->_history.rend();
+			++pos)
+		{
+			board.undo_move(*pos);
+			if (!board.is_reversible(*pos))
+			{
+				break;
+			}
+			history.push_back(board.get_zobrist());
+		}
+
+		std::reverse(history.begin(), history.end());
+		return history;
+	}
+
+	/** @param pondered The best moves are found by pondering on the
+	 *   expected reply, no more thinking is needed.
+	 */
+	void engine::computer_makes_move(bool pondered)
 	{
 		if (this->_force_mode)
 		{
@@ -342,9 +397,17 @@ namespace checkers
 		std::vector<move> moves;
 		do
 		{
-			absearch::think(this->_best_moves, this->_board,
-				this->_depth_limit, this->_time_limit,
-				this->_verbose);
+			if (!pondered || this->_best_moves.empty())
+			{
+				search_context context(this->_depth_limit,
+					this->time_limit(), this->_node_limit);
+				context.set_poll(&engine::poll_input);
+				absearch::set_history(
+					this->reversible_history());
+				absearch::think(this->_best_moves,
+					this->_board, context, this->_verbose);
+			}
+			pondered = false;
 			if (this->_best_moves.empty())
 			{
 				break;
@@ -389,6 +452,12 @@ namespace checkers
 		return contin;
 	}
 
+	int engine::time_limit(void) const
+	{
+		return this->_node_limit ? search_context::UNLIMITED :
+			this->_time_limit;
+	}
+
 	void engine::idle(void)
 	{
 		for (;;)
@@ -402,14 +471,154 @@ namespace checkers
 		}
 	}
 
+	/**  Guess the reply of the opponent from the best moves, and think
+	 *   on the position after it while waiting for the opponent.  When
+	 *   the opponent makes the expected reply, the search keeps on
+	 *   running against the clock, otherwise it is aborted, but the hash
+	 *   table is still warm.  There is no pondering with a node limit,
+	 *   which would fill the hash table by the clock.
+	 */
 	void engine::ponder(void)
 	{
-		if (this->_force_mode || !absearch::think(
-			this->_best_moves, this->_board, engine::UNLIMITED,
-			engine::UNLIMITED, this->_verbose))
+		if (this->_force_mode || !this->_ponder || this->_node_limit)
 		{
 			this->idle();
+			return;
+		}
+
+		if (this->_best_moves.empty())
+		{
+			// Nothing expected yet, think on the opponent's move.
+			search_context context(this->_depth_limit,
+				this->time_limit(), this->_node_limit);
+			context.set_poll(&engine::poll_input);
+			absearch::set_history(this->reversible_history());
+			absearch::think(this->_best_moves, this->_board, context,
+				this->_verbose);
+			if (this->_best_moves.empty() ||
+				nio.lines_to_read() || nio.eof())
+			{
+				this->idle();
+				return;
+			}
+		}
+
+		board board = this->_board;
+		std::vector<packed_move> best_moves = this->_best_moves;
+		std::vector<zobrist> history = this->reversible_history();
+		bool contin;
+
+		this->_ponder_moves.clear();
+		do
+		{
+			this->_ponder_moves.push_back(best_moves.front());
+			if (board.is_reversible(best_moves.front()))
+			{
+				history.push_back(board.get_zobrist());
+			}
+			else
+			{
+				history.clear();
+			}
+			contin = board.make_move(best_moves.front());
+			best_moves.erase(best_moves.begin());
+		} while (contin && !best_moves.empty());
+
+		if (contin || board.is_winning() || board.is_losing())
+		{
+			this->_ponder_moves.clear();
+			this->idle();
+			return;
+		}
+
+		search_context context(this->_depth_limit);
+		context.set_poll(&engine::poll_ponder_input);
+		this->_ponder_context = &context;
+		absearch::set_history(history);
+		bool timeout = absearch::think(best_moves, board, context,
+			this->_verbose);
+		this->_ponder_context = NULL;
+
+		if (this->_ponder_moves.empty())
+		{
+			// Ponder hit, the opponent has made the expected reply.
+			this->_best_moves = best_moves;
+			this->computer_makes_move(true);
+			return;
+		}
+
+		// Keep the rest of the expected reply with the deeper moves.
+		this->_best_moves = this->_ponder_moves;
+		this->_best_moves.insert(this->_best_moves.end(),
+			best_moves.begin(), best_moves.end());
+		this->_ponder_moves.clear();
+
+		if (!timeout)
+		{
+			this->idle();
+		}
+	}
+
+	/** @return whether to keep on pondering.
+	 *  @retval true when the opponent made the expected reply, and the
+	 *   search is converted to a timed search.
+	 *  @retval false when other input is ready.
+	 */
+	bool engine::ponder_input(void)
+	{
+		engine& engine = engine::init();
+
+		while (nio.lines_to_read() && !engine._ponder_moves.empty())
+		{
+			std::vector<std::string> args =
+				engine::parse(nio.peekline());
+			if (args.empty())
+			{
+				std::string command;
+				nio >> command;
+				continue;
+			}
+
+			try
+			{
+				if (packed_move(engine._board.parse_move(
+					args[0])) != engine._ponder_moves.front())
+				{
+					return false;
+				}
+			}
+			catch (const std::logic_error& e)
+			{
+				return false;
+			}
+
+			std::string command;
+			nio >> command;
+			engine.human_makes_move(args[0]);
+			engine._ponder_moves.erase(
+				engine._ponder_moves.begin());
+
+			if (engine._ponder_moves.empty())
+			{
+				engine._ponder_context->set_timeout(
+					engine._time_limit);
+			}
 		}
+
+		return !nio.lines_to_read();
+	}
+
+	bool engine::poll_input(void)
+	{
+		nio << io::flush;
+		return nio.eof() || nio.lines_to_read();
+	}
+
+	bool engine::poll_ponder_input(void)
+	{
+		nio << io::flush;
+		return nio.eof() ||
+			(nio.lines_to_read() && !engine::ponder_input());
 	}
 
 	void engine::prompt(void)
@@ -438,6 +647,22 @@ namespace checkers
 			return true;
 		}
 
+		// The third time the same position with the same player on move
+		const std::vector<zobrist> history = this->reversible_history();
+		if (std::count(history.begin(), history.end(),
+			this->_board.get_zobrist()) >= 2)
+		{
+			nio << "[Result \"1/2-1/2\"]\n{Draw by repetition}\n";
+			return true;
+		}
+		if (this->_board.get_reversible_moves() >=
+			board::REVERSIBLE_MOVES_LIMIT)
+		{
+			nio << "[Result \"1/2-1/2\"]\n"
+				"{Draw by the 40-move rule}\n";
+			return true;
+		}
+
 		return false;
 	}
 
@@ -447,8 +672,199 @@ namespace checkers
 		(void)args;
 
 		nio << "  Analyzing ...\n";
-		absearch::think(this->_best_moves, this->_board,
-			this->_depth_limit, this->_time_limit, true);
+		search_context context(this->_depth_limit, this->time_limit(),
+			this->_node_limit);
+		context.set_poll(&engine::poll_input);
+		absearch::set_history(this->reversible_history());
+		absearch::think(this->_best_moves, this->_board, context, true,
+			this->_multipv);
+	}
+
+	/**  Search the positions of the benchmark to a fixed depth, with a
+	 *   search state of its own, so that the nodes searched do not depend
+	 *   on the earlier searches.  It thinks on the helper threads as the
+	 *   engine does.
+	 */
+	void engine::do_bench(const std::vector<std::string>& args)
+	{
+		static const char* const positions[] = {
+			"B:W21,22,23,24,25,26,27,28,29,30,31,32"
+				":B1,2,3,4,5,6,7,8,9,10,11,12",
+			"B:W17,18,21,23,24,25,27,28,29,30,31,32"
+				":B1,2,3,4,5,7,8,9,10,11,15,16",
+			"W:W14,19,21,22,24,25,26,28,29,30,31,32"
+				":B1,2,3,4,5,6,8,9,10,11,12",
+			"B:W14,17,21,24,27,29,30,31,32:B1,2,3,4,5,7,10,16",
+			"B:W14,19,24,27,28,29,32:B2,3,4,5,8,11,12",
+			"W:W10,13,19,21,28:B1,3,5,20,K30",
+			"B:W21,28,29,K26:B4,13,K6,K7",
+			"W:WK5,K12,K13:BK3,K21,K28,K31"
+		};
+		const unsigned int depth = args.size() > 1 ?
+			this->to_int(args[1]) : engine::BENCH_DEPTH;
+		absearch::state state(true);
+		long unsigned int nodes = 0;
+		struct timeval time = { 0, 0 };
+
+		for (std::size_t i = 0;
+			i < sizeof(positions) / sizeof(positions[0]); ++i)
+		{
+			board board(positions[i]);
+			std::vector<packed_move> best_moves;
+			search_context context(depth);
+			struct timeval start = timeval::now();
+			absearch::think(state, best_moves, board, context);
+			struct timeval end = timeval::now();
+
+			std::ostringstream stream;
+			stream << board << ' ';
+			if (best_moves.empty())
+			{
+				stream << '-';
+			}
+			else
+			{
+				stream << best_moves.front();
+			}
+			stream << ' ' << state.get_value() << ' ' <<
+				state.get_depth() << ' ' << state.get_nodes() <<
+				' ' << (end - start).tv_sec << '.' <<
+				std::setw(3) << std::setfill('0') <<
+				((end - start).tv_usec / 1000) << '\n';
+			nio << stream.str();
+
+			nodes += state.get_nodes();
+			time += end - start;
+		}
+
+		const double seconds = time.tv_sec + time.tv_usec / 1e6;
+		std::ostringstream stream;
+		stream << "  " << nodes << " nodes in " << time.tv_sec << '.' <<
+			std::setw(3) << std::setfill('0') <<
+			(time.tv_usec / 1000) << " seconds, " <<
+			static_cast<long unsigned int>(seconds > 0 ?
+			nodes / seconds : 0) << " nodes per second.\n";
+		nio << stream.str();
+	}
+
+	/**  Read the positions in FEN of the file at @e path, one per line.
+	 *   An illegal position is reported and skipped.
+	 */
+	bool engine::read_boards(const std::string& path,
+		std::vector<std::string>& fens,
+		std::vector<packed_board>& boards)
+	{
+		std::ifstream ifs(path.c_str());
+		if (!ifs)
+		{
+			nio << "Error (cannot open): " << path << '\n';
+			return false;
+		}
+
+		std::string line;
+		while (std::getline(ifs, line))
+		{
+			if (line.empty())
+			{
+				continue;
+			}
+
+			try
+			{
+				boards.push_back(packed_board::pack(board(line)));
+				fens.push_back(line);
+			}
+			catch (const std::logic_error& e)
+			{
+				nio << e.what() << '\n';
+			}
+		}
+
+		return true;
+	}
+
+	void engine::do_classify(const std::vector<std::string>& args)
+	{
+		if (args.size() <= 1)
+		{
+			nio << "Error (option missing): classify\n";
+			return;
+		}
+
+		std::vector<std::string> fens;
+		std::vector<packed_board> boards;
+		if (!this->read_boards(args[1], fens, boards))
+		{
+			return;
+		}
+
+		std::vector<boardlanes::classification> classes(boards.size());
+		struct timeval start = timeval::now();
+		if (!boards.empty())
+		{
+			boardlanes::classify(&boards[0], &classes[0],
+				boards.size());
+		}
+		struct timeval time = timeval::now() - start;
+
+		std::vector<boardlanes::classification>::size_type captures = 0;
+		std::vector<boardlanes::classification>::size_type terminals = 0;
+		for (std::vector<boardlanes::classification>::size_type i = 0;
+			i < classes.size(); ++i)
+		{
+			nio << fens[i] << ' ' << classes[i].mobility << ' ' <<
+				(classes[i].forced_capture ? "capture" : "-") <<
+				' ' << (classes[i].terminal ? "terminal" : "-") <<
+				'\n';
+			captures += classes[i].forced_capture;
+			terminals += classes[i].terminal;
+		}
+
+		std::ostringstream stream;
+		stream << "  " << classes.size() << " positions in " <<
+			time.tv_sec << '.' << std::setw(6) <<
+			std::setfill('0') << time.tv_usec << " seconds, " <<
+			captures << " forced captures, " << terminals <<
+			" terminal.\n";
+		nio << stream.str();
+	}
+
+	/**  The positions are evaluated by a batch, only the batch is timed.
+	 */
+	void engine::do_evalbatch(const std::vector<std::string>& args)
+	{
+		if (args.size() <= 1)
+		{
+			nio << "Error (option missing): evalbatch\n";
+			return;
+		}
+
+		std::vector<std::string> fens;
+		std::vector<packed_board> boards;
+		if (!this->read_boards(args[1], fens, boards))
+		{
+			return;
+		}
+
+		std::vector<int> values(boards.size());
+		struct timeval start = timeval::now();
+		if (!boards.empty())
+		{
+			evaluate::evaluate(&boards[0], &values[0],
+				boards.size());
+		}
+		struct timeval time = timeval::now() - start;
+
+		for (std::vector<int>::size_type i = 0; i < values.size(); ++i)
+		{
+			nio << fens[i] << ' ' << values[i] << '\n';
+		}
+
+		std::ostringstream stream;
+		stream << "  " << values.size() << " positions in " <<
+			time.tv_sec << '.' << std::setw(6) <<
+			std::setfill('0') << time.tv_usec << " seconds.\n";
+		nio << stream.str();
 	}
 
 	void engine::do_print(const std::vector<std::string>& args)
@@ -477,6 +893,37 @@ namespace checkers
 		this->_best_moves.clear();
 	}
 
+	void engine::do_weights(const std::vector<std::string>& args)
+	{
+		if (args.size() > 1)
+		{
+			std::ifstream ifs(args[1].c_str());
+			if (!ifs)
+			{
+				nio << "Error (cannot open): " << args[1] << '\n';
+				return;
+			}
+
+			try
+			{
+				evaluate::load_weights(ifs);
+			}
+			catch (const std::logic_error& e)
+			{
+				nio << e.what() << '\n';
+				return;
+			}
+		}
+
+		const evaluate::weights& weights = evaluate::get_weights();
+		nio << "  man " << weights.man << '\n'
+			<< "  king " << weights.king << '\n'
+			<< "  mover " << weights.mover << '\n'
+			<< "  kings_row " << weights.kings_row << '\n'
+			<< "  edge " << weights.edge << '\n'
+			<< "  pattern " << weights.pattern << '\n';
+	}
+
 	void engine::do_white(const std::vector<std::string>& args)
 	{
 		// Void the warning: unused parameter ‘args’
@@ -499,6 +946,23 @@ namespace checkers
 		nio << '\n';
 	}
 
+	void engine::do_ponder(const std::vector<std::string>& args)
+	{
+		// Void the warning: unused parameter ‘args’
+		(void)args;
+
+		if (this->_ponder)
+		{
+			this->_ponder = false;
+			nio << "  Pondering off.\n";
+		}
+		else
+		{
+			this->_ponder = true;
+			nio << "  Pondering on.\n";
+		}
+	}
+
 	void engine::do_go(const std::vector<std::string>& args)
 	{
 		// Void the warning: unused parameter ‘args’
@@ -508,6 +972,43 @@ namespace checkers
 		this->computer_makes_move();
 	}
 
+	/**  The records searched shallower than DEPTH are not saved.
+	 */
+	void engine::do_hash(const std::vector<std::string>& args)
+	{
+		if (args.size() <= 2 || ("save" != args[1] &&
+			"load" != args[1] && "share" != args[1]))
+		{
+			nio << "Error (option missing): hash\n";
+			return;
+		}
+
+		try
+		{
+			std::ostringstream stream;
+			if ("save" == args[1])
+			{
+				stream << "  " << absearch::save_hash(args[2],
+					args.size() > 3 ? this->to_int(args[3]) : 0)
+					<< " records saved.\n";
+			}
+			else if ("load" == args[1])
+			{
+				stream << "  " << absearch::load_hash(args[2]) <<
+					" records loaded.\n";
+			}
+			else
+			{
+				absearch::share_hash(args[2]);
+			}
+			nio << stream.str();
+		}
+		catch (const std::exception& e)
+		{
+			nio << e.what() << '\n';
+		}
+	}
+
 	void engine::do_help(const std::vector<std::string>& args)
 	{
 		// Void the warning: unused parameter ‘args’
@@ -519,32 +1020,68 @@ namespace checkers
 		"    analyze         Engine thinks about what move it make next"
 			" if it were on\n"
 		"                    move.\n"
+		"    bench [DEPTH]   Search the positions of the benchmark to"
+			" DEPTH ply.\n"
 		"    black           Set Black on move, and the engine will"
 			" play White.\n"
+		"    classify FILE   Classify the positions in FEN of FILE,"
+			" one per line, by\n"
+		"                    the moves without a capture, a forced"
+			" capture and no\n"
+		"                    legal move.\n"
+		"    evalbatch FILE  Evaluate the positions in FEN of FILE,"
+			" one per line.\n"
 		"    force           Set the engine to play neither color"
 			" (\"force mode\").\n"
 		"    go              Leave force mode and set the engine to"
 			" play the color that\n"
 		"                    is on move.  Start thinking and eventually"
 			" make a move.\n"
+		"    hash save FILE [DEPTH]\n"
+		"                    Save the hash table searched to DEPTH ply"
+			" at least to FILE.\n"
+		"    hash load FILE  Load the hash table saved in FILE.\n"
+		"    hash share NAME Share the hash table in the shared memory"
+			" segment NAME.\n"
 		"    help            Show this help information.\n"
 		"    history         Show the record of moves.\n"
+		"    multipv K       Analyze shows the best K moves with their"
+			" values.\n"
 		"    new             Reset the board to the standard starting"
 			" position.\n"
 		"    ping N          N is a decimal number.  Reply by sending"
 			" the string\n"
 		"                    \"pong N\"\n"
+		"    ponder          Toggle pondering on the opponent's expected"
+			" reply.\n"
 		"    print           Show the current board.\n"
 		"    quit            Quit this program.\n"
 		"    rotate          Rotate the board 180 degrees.\n"
 		"    setboard FEN    Set up the pieces position on the"
 			" board.\n"
+		"    setoption NAME VALUE\n"
+		"                    Set the weight NAME of the evaluation to"
+			" VALUE, NAME is\n"
+		"                    one of man, king, mover, kings_row, edge"
+			" and pattern.\n"
+		"                    Or turn the option NAME off with VALUE 0,"
+			" NAME is one of\n"
+		"                    reductions, futility, etc and endgame.\n"
+		"                    Or search with VALUE threads, at most 64,"
+			" for NAME threads.\n"
 		"    sd DEPTH        The engine should limit its thinking to"
 			" DEPTH ply.\n"
+		"    sn NODES        The engine should limit its thinking to"
+			" NODES nodes,\n"
+		"                    0 for no limit.  The time is not limited"
+			" then.\n"
 		"    st TIME         Set the time control to TIME seconds per"
 			" move.\n"
 		"    undo            Back up a move.\n"
 		"    verbose         Toggle verbose mode.\n"
+		"    weights [FILE]  Load the weights of the evaluation from"
+			" FILE, or show\n"
+		"                    the current weights.\n"
 		"    white           Set White on move, and the engine will"
 			" play Black.\n";
 		// --+----1----+----2----+----3----+----4----+----5----+----6--|
@@ -570,6 +1107,7 @@ namespace checkers
 
 		this->_board = board();
 		this->_history.clear();
+		this->_reversible_moves.clear();
 		this->_best_moves.clear();
 		this->print_board();
 	}
@@ -600,6 +1138,30 @@ namespace checkers
 		this->_depth_limit = this->to_int(args[1]);
 	}
 
+	/**  A search of a node limit is the same on every run, it neither
+	 *   depends on the clock nor on the pondering, see engine::ponder().
+	 */
+	void engine::do_sn(const std::vector<std::string>& args)
+	{
+		if (args.size() <= 1)
+		{
+			nio << "Error (option missing): sn\n";
+			return;
+		}
+		this->_node_limit = "unlimited" == args[1] ? 0 :
+			std::strtoul(args[1].c_str(), NULL, 10);
+	}
+
+	void engine::do_multipv(const std::vector<std::string>& args)
+	{
+		if (args.size() <= 1)
+		{
+			nio << "Error (option missing): multipv\n";
+			return;
+		}
+		this->_multipv = std::max(this->to_int(args[1]), 1);
+	}
+
 	void engine::do_st(const std::vector<std::string>& args)
 	{
 		if (args.size() <= 1)
@@ -629,11 +1191,64 @@ namespace checkers
 		}
 
 		this->_history.clear();
+		this->_reversible_moves.clear();
 		this->_best_moves.clear();
 		this->print_board();
 		nio << io::flush;
 	}
 
+	void engine::do_setoption(const std::vector<std::string>& args)
+	{
+		if (args.size() <= 2)
+		{
+			nio << "Error (option missing): setoption\n";
+			return;
+		}
+
+		const int value = std::strtol(args[2].c_str(), NULL, 10);
+		if ("reductions" == args[1])
+		{
+			absearch::set_reductions(value);
+			return;
+		}
+		if ("futility" == args[1])
+		{
+			absearch::set_futility(value);
+			return;
+		}
+		if ("etc" == args[1])
+		{
+			absearch::set_etc(value);
+			return;
+		}
+		if ("endgame" == args[1])
+		{
+			evaluate::set_endgame(value);
+			return;
+		}
+		if ("threads" == args[1])
+		{
+			try
+			{
+				absearch::set_threads(std::max(value, 1));
+			}
+			catch (const std::runtime_error& e)
+			{
+				nio << e.what() << '\n';
+			}
+			return;
+		}
+
+		try
+		{
+			evaluate::set_weight(args[1], value);
+		}
+		catch (const std::logic_error& e)
+		{
+			nio << e.what() << '\n';
+		}
+	}
+
 	void engine::do_undo(const std::vector<std::string>& args)
 	{
 		// Void the warning: unused parameter ‘args’
@@ -641,8 +1256,10 @@ namespace checkers
 
 		if (this->_history.size() > 0)
 		{
-			this->_board.undo_move(this->_history.back());
+			this->_board.undo_move(this->_history.back(),
+				this->_reversible_moves.back());
 			this->_history.pop_back();
+			this->_reversible_moves.pop_back();
 			this->_best_moves.clear();
 			this->print_board();
 		}
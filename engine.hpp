@@ -29,6 +29,8 @@
 
 #include <map>
 #include "board.hpp"
+#include "packedboard.hpp"
+#include "searchcontext.hpp"
 
 namespace checkers
 {
@@ -55,45 +57,83 @@ namespace checkers
 			const std::string& command);
 
 		bool make_move(const move& move);
+		/** @brief Get the zobrist keys of the positions before the
+		 *   current one, from the last irreversible move.
+		 */
+		std::vector<zobrist> reversible_history(void) const;
 
-		void computer_makes_move(void);
+		void computer_makes_move(bool pondered = false);
 		bool human_makes_move(const std::string& str);
 
+		/// The time limit of a think, none with a node limit.
+		int time_limit(void) const;
 		void idle(void);
 		void ponder(void);
+		static bool ponder_input(void);
+		/// Whether new input is ready, which stops the search.
+		static bool poll_input(void);
+		/** @brief Whether new input is ready, which stops pondering
+		 *   unless it is the expected reply.
+		 */
+		static bool poll_ponder_input(void);
 
 		void prompt(void);
 		bool result(void);
 
+		bool read_boards(const std::string& path,
+			std::vector<std::string>& fens,
+			std::vector<packed_board>& boards);
+
 		void do_analyze(const std::vector<std::string>& args);
+		void do_bench(const std::vector<std::string>& args);
 		void do_black(const std::vector<std::string>& args);
+		void do_classify(const std::vector<std::string>& args);
+		void do_evalbatch(const std::vector<std::string>& args);
 		void do_force(const std::vector<std::string>& args);
 		void do_go(const std::vector<std::string>& args);
+		void do_hash(const std::vector<std::string>& args);
 		void do_help(const std::vector<std::string>& args);
 		void do_history(const std::vector<std::string>& args);
+		void do_multipv(const std::vector<std::string>& args);
 		void do_new(const std::vector<std::string>& args);
 		void do_ping(const std::vector<std::string>& args);
+		void do_ponder(const std::vector<std::string>& args);
 		void do_print(const std::vector<std::string>& args);
 		void do_quit(const std::vector<std::string>& args);
 		void do_rotate(const std::vector<std::string>& args);
 		void do_sd(const std::vector<std::string>& args);
+		void do_sn(const std::vector<std::string>& args);
 		void do_st(const std::vector<std::string>& args);
 		void do_setboard(const std::vector<std::string>& args);
+		void do_setoption(const std::vector<std::string>& args);
 		void do_undo(const std::vector<std::string>& args);
 		void do_verbose(const std::vector<std::string>& args);
+		void do_weights(const std::vector<std::string>& args);
 		void do_white(const std::vector<std::string>& args);
 		void not_implemented(const std::vector<std::string>& args);
 
 		board _board;
 		bool _rotate;
 		std::vector<move> _history;
-		std::vector<move> _best_moves;
+		/// The reversible moves of the board before each move.
+		std::vector<unsigned int> _reversible_moves;
+		std::vector<packed_move> _best_moves;
 		bool _force_mode;
 		int _depth_limit;
 		int _time_limit;
+		/// The node limit of a think, 0 for none.
+		long unsigned int _node_limit;
+		int _multipv;
 		bool _verbose;
+		bool _ponder;
+		/// The expected reply of the opponent while pondering.
+		std::vector<packed_move> _ponder_moves;
+		/// The context of the search while pondering.
+		search_context* _ponder_context;
 
 		static const int UNLIMITED = 999999;
+		/// The default depth of the benchmark.
+		static const int BENCH_DEPTH = 13;
 
 		typedef void (engine::*do_action)(const std::vector<std::string>&);
 		std::map<std::string, do_action> _action;
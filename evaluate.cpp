@@ -24,21 +24,229 @@
  *  @brief Artificial intelligence, weight of evaluate strategy.
  */
 
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+#include "boardlanes.hpp"
+#include "endgame.hpp"
 #include "evaluate.hpp"
+#include "pattern.hpp"
 
 namespace checkers
 {
+	namespace evaluate
+	{
+		/// The compile time weights.
+		const weights DEFAULT_WEIGHTS =
+		{
+			evaluate::WEIGHT_MAN,
+			evaluate::WEIGHT_KING,
+			evaluate::WEIGHT_MOVER,
+			evaluate::WEIGHT_KINGS_ROW,
+			evaluate::WEIGHT_EDGE,
+			evaluate::WEIGHT_PATTERN
+		};
+
+		weights _weights = DEFAULT_WEIGHTS;
+		/// Whether the current weights are the compile time weights.
+		bool _default_weights = true;
+		/// Whether the endgames are evaluated by the material signature.
+		bool _endgame = true;
+
+		inline int sum(const board& board, const weights& weights);
+	}
+
+	/**  The terms are weighted by constants with the compile time weights,
+	 *   which are folded by the compiler.  The endgame terms are not
+	 *   weighted, nor tuned.
+	 */
+	inline int evaluate::sum(const board& board, const weights& weights)
+	{
+		return men(board) * weights.man +
+			kings(board) * weights.king +
+			movers(board) * weights.mover +
+			kings_row(board) * weights.kings_row +
+			edges(board) * weights.edge +
+			patterns(board) * weights.pattern +
+			(evaluate::_endgame ? endgame::evaluate(board) : 0);
+	}
+
 	/**
 	 *  @retval >0 when the current player is ahead in game
 	 *  @retval <0 when the current player is behind in game
 	 */
 	int evaluate::evaluate(const board& board)
 	{
-		return men(board) * evaluate::WEIGHT_MAN +
-			kings(board) * evaluate::WEIGHT_KING +
-			movers(board) * evaluate::WEIGHT_MOVER +
-			kings_row(board) * evaluate::WEIGHT_KINGS_ROW +
-			edges(board) * evaluate::WEIGHT_EDGE;
+		return evaluate::_default_weights ?
+			evaluate::sum(board, evaluate::DEFAULT_WEIGHTS) :
+			evaluate::sum(board, evaluate::_weights);
+	}
+
+	int evaluate::evaluate(const board& board, const weights& weights)
+	{
+		return evaluate::sum(board, weights);
+	}
+
+	/**  All the terms but the patterns are evaluated on bitlanes::LANES
+	 *   game boards at once, the same as evaluate::evaluate(const board&)
+	 *   for each game board.  The patterns and the endgames are looked up
+	 *   one by one.
+	 */
+	void evaluate::evaluate(const packed_board* boards, int* values,
+		std::size_t size)
+	{
+		const weights& weights = evaluate::_weights;
+		uint32_t result[bitlanes::LANES];
+		std::size_t i;
+		std::size_t j;
+
+		for (i = 0; i < size; i += bitlanes::LANES)
+		{
+			const boardlanes lanes(boards + i, size - i);
+			const bitlanes black_pieces = lanes.get_black_pieces();
+			const bitlanes white_pieces = lanes.get_white_pieces();
+
+			const bitlanes val =
+				(lanes.get_black_men().count() -
+				 lanes.get_white_men().count()) *
+				weights.man +
+				(lanes.get_black_kings().count() -
+				 lanes.get_white_kings().count()) *
+				weights.king +
+				(lanes.get_black_movers().count() -
+				 lanes.get_white_movers().count()) *
+				weights.mover +
+				((black_pieces & bitboard::WHITE_KINGS_ROW).count() -
+				 (white_pieces & bitboard::BLACK_KINGS_ROW).count()) *
+				weights.kings_row +
+				((black_pieces & bitboard::EDGES).count() -
+				 (white_pieces & bitboard::EDGES).count()) *
+				weights.edge;
+			(val * lanes.get_signs()).store(result);
+
+			for (j = 0; j < bitlanes::LANES && i + j < size; ++j)
+			{
+				const packed_board& board = boards[i + j];
+				int pattern = pattern::evaluate(
+					board.black_pieces, board.white_pieces,
+					board.kings);
+
+				values[i + j] = static_cast<int32_t>(result[j]) +
+					(board.black_to_move ? pattern : -pattern) *
+					weights.pattern;
+				if (evaluate::_endgame)
+				{
+					values[i + j] += endgame::evaluate(
+						board.black_pieces,
+						board.white_pieces, board.kings,
+						board.black_to_move);
+				}
+			}
+		}
+	}
+
+	const evaluate::weights& evaluate::get_weights(void)
+	{
+		return evaluate::_weights;
+	}
+
+	void evaluate::set_weights(const weights& weights)
+	{
+		evaluate::_weights = weights;
+		evaluate::_default_weights =
+			weights.man == DEFAULT_WEIGHTS.man &&
+			weights.king == DEFAULT_WEIGHTS.king &&
+			weights.mover == DEFAULT_WEIGHTS.mover &&
+			weights.kings_row == DEFAULT_WEIGHTS.kings_row &&
+			weights.edge == DEFAULT_WEIGHTS.edge &&
+			weights.pattern == DEFAULT_WEIGHTS.pattern;
+	}
+
+	/** @param name The name of the weight, as @e man or @e WEIGHT_MAN.
+	 */
+	void evaluate::set_weight(const std::string& name, int value)
+	{
+		std::string key = name.compare(0, 7, "WEIGHT_") ? name :
+			name.substr(7);
+		weights weights = evaluate::_weights;
+
+		for (std::string::iterator pos = key.begin(); pos != key.end();
+			++pos)
+		{
+			*pos = std::tolower(*pos);
+		}
+
+		if ("man" == key)
+		{
+			weights.man = value;
+		}
+		else if ("king" == key)
+		{
+			weights.king = value;
+		}
+		else if ("mover" == key)
+		{
+			weights.mover = value;
+		}
+		else if ("kings_row" == key)
+		{
+			weights.kings_row = value;
+		}
+		else if ("edge" == key)
+		{
+			weights.edge = value;
+		}
+		else if ("pattern" == key)
+		{
+			weights.pattern = value;
+		}
+		else
+		{
+			/// @throw std::logic_error when @e name is unknown.
+			throw std::logic_error("Error (unknown weight): " + name);
+		}
+
+		evaluate::set_weights(weights);
+	}
+
+	/**  Each line is a name and a value, as ``man 256''.  The source file
+	 *   written by the tuner can be loaded too, the ``const int'', ``=''
+	 *   and ``;'' are ignored, and so are the lines without a value.
+	 */
+	void evaluate::load_weights(std::istream& is)
+	{
+		std::string line;
+
+		while (std::getline(is, line))
+		{
+			for (std::string::iterator pos = line.begin();
+				pos != line.end(); ++pos)
+			{
+				if ('=' == *pos || ';' == *pos)
+				{
+					*pos = ' ';
+				}
+			}
+
+			std::istringstream stream(line);
+			std::string name;
+			int value;
+
+			stream >> name;
+			if ("const" == name)
+			{
+				stream >> name >> name;
+			}
+			if (stream >> value)
+			{
+				evaluate::set_weight(name, value);
+			}
+		}
+	}
+
+	void evaluate::set_endgame(bool endgame)
+	{
+		evaluate::_endgame = endgame;
 	}
 
 	int evaluate::men(const board& board)
@@ -89,6 +297,12 @@ namespace checkers
 			((board.get_white_pieces() & bitboard::EDGES).count() -
 			 (board.get_black_pieces() & bitboard::EDGES).count());
 	}
+
+	int evaluate::patterns(const board& board)
+	{
+		return board.is_black_to_move() ? pattern::evaluate(board) :
+			-pattern::evaluate(board);
+	}
 }
 
 // End of file
@@ -27,7 +27,11 @@
 #ifndef __EVALUATE_HPP__
 #define __EVALUATE_HPP__
 
+#include <cstddef>
+#include <istream>
+#include <string>
 #include "board.hpp"
+#include "packedboard.hpp"
 
 namespace checkers
 {
@@ -39,17 +43,60 @@ namespace checkers
 		const int WEIGHT_MOVER     = 2;
 		const int WEIGHT_KINGS_ROW = 16;
 		const int WEIGHT_EDGE      = 8;
+		const int WEIGHT_PATTERN   = 1;
+
+		/// The weights of the evaluate terms.
+		struct weights
+		{
+			int man;
+			int king;
+			int mover;
+			int kings_row;
+			int edge;
+			int pattern;
+		};
 
 		inline int win(void);
+		inline int draw(void);
 		inline int infinity(void);
 		inline int unknown(void);
+		/// Whether the value is of a game won or lost at some ply.
+		inline bool is_decisive(int val);
+		/** @brief Get the value of the search, won or lost at some
+		 *   ply from the root, as won or lost from a node @e ply deep.
+		 */
+		inline int from_root(int val, unsigned int ply);
+		/// The reverse of from_root().
+		inline int to_root(int val, unsigned int ply);
 
+		/** @brief Evaluate with the current weights, which are the
+		 *   compile time weights unless changed.
+		 */
 		int evaluate(const board& board);
+		/// Evaluate with the @e weights.
+		int evaluate(const board& board, const weights& weights);
+		/** @brief Evaluate @e size game boards with the current
+		 *   weights, a number of game boards at once by SIMD.
+		 */
+		void evaluate(const packed_board* boards, int* values,
+			std::size_t size);
+
+		/// Get the current weights.
+		const weights& get_weights(void);
+		/// Set the current weights.
+		void set_weights(const weights& weights);
+		/// Set one of the current weights by name.
+		void set_weight(const std::string& name, int value);
+		/// Load the current weights from a stream.
+		void load_weights(std::istream& is);
+		/// Turn the endgame evaluators on or off.
+		void set_endgame(bool endgame);
 		int men(const board& board);
 		int kings(const board& board);
 		int movers(const board& board);
 		int kings_row(const board& board);
 		int edges(const board& board);
+		int patterns(const board& board);
 	}
 }
 
@@ -36,6 +36,11 @@ namespace checkers
 		return evaluate::WEIGHT_MAN * 256;
 	}
 
+	inline int evaluate::draw(void)
+	{
+		return 0;
+	}
+
 	inline int evaluate::infinity(void)
 	{
 		return std::numeric_limits<int>::max();
@@ -45,6 +50,27 @@ namespace checkers
 	{
 		return std::numeric_limits<int>::min();
 	}
+
+	inline bool evaluate::is_decisive(int val)
+	{
+		return val > win() - WEIGHT_MAN || val < -win() + WEIGHT_MAN;
+	}
+
+	/**  The other values are the same from any node.
+	 */
+	inline int evaluate::from_root(int val, unsigned int ply)
+	{
+		return !is_decisive(val) ? val :
+			val > 0 ? val + static_cast<int>(ply) :
+			val - static_cast<int>(ply);
+	}
+
+	inline int evaluate::to_root(int val, unsigned int ply)
+	{
+		return !is_decisive(val) ? val :
+			val > 0 ? val - static_cast<int>(ply) :
+			val + static_cast<int>(ply);
+	}
 }
 
 #endif // __EVALUATE_I_HPP__
@@ -0,0 +1,153 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file hashtable.cpp
+ *  @brief Hash table of the alpha-beta search.
+ */
+
+extern "C"
+{
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+}
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include "hashtable.hpp"
+
+namespace checkers
+{
+	hashtable::hashtable(std::size_t size) :
+		_size(size), _records(hashtable::allocate(size)),
+		_generation(0), _stores(0), _deep_stores(0), _replaced(0)
+	{
+	}
+
+	hashtable::~hashtable(void)
+	{
+		if (this->_records)
+		{
+			munmap(this->_records, this->_size * sizeof(record));
+		}
+	}
+
+	void hashtable::resize(std::size_t size)
+	{
+		record* records = hashtable::allocate(size);
+
+		if (this->_records)
+		{
+			munmap(this->_records, this->_size * sizeof(record));
+		}
+		this->_size = size;
+		this->_records = records;
+	}
+
+	/**  The segment stays after the processes exit, until removed, e.g.
+	 *   from /dev/shm on Linux.  All the processes sharing a segment
+	 *   should have the same table size and the same weights.
+	 */
+	void hashtable::share(const std::string& name)
+	{
+		const std::size_t length = this->_size * sizeof(record);
+		int fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+		struct stat st;
+
+		if (fd < 0 || fstat(fd, &st) < 0 || (0 == st.st_size &&
+			ftruncate(fd, length) < 0))
+		{
+			const int error = errno;
+			if (fd >= 0)
+			{
+				close(fd);
+			}
+			/** @throw std::runtime_error when the segment is not
+			 *   opened.
+			 */
+			throw std::runtime_error("Error (cannot share): " + name +
+				": " + std::strerror(error));
+		}
+		if (0 != st.st_size && length != std::size_t(st.st_size))
+		{
+			close(fd);
+			/** @throw std::logic_error when the segment is of
+			 *   another size.
+			 */
+			throw std::logic_error("Error (illegal hash segment): " +
+				name);
+		}
+
+		void* map = mmap(NULL, length, PROT_READ | PROT_WRITE,
+			MAP_SHARED, fd, 0);
+		const int error = errno;
+		close(fd);
+		if (MAP_FAILED == map)
+		{
+			throw std::runtime_error("Error (cannot share): " + name +
+				": " + std::strerror(error));
+		}
+
+		munmap(this->_records, length);
+		this->_records = static_cast<record*>(map);
+	}
+
+	/**  The memory is mapped anonymously, so the pages are zero filled,
+	 *   which are empty records, only when touched.  Huge pages are
+	 *   advised, as the records are accessed at random.
+	 */
+	record* hashtable::allocate(std::size_t size)
+	{
+		if (0 == size)
+		{
+			return NULL;
+		}
+
+		void* map = mmap(NULL, size * sizeof(record),
+			PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (MAP_FAILED == map)
+		{
+			/// @throw std::runtime_error when mmap() failed.
+			throw std::runtime_error(
+				std::string("mmap() failed: ")
+				+ std::strerror(errno));
+		}
+		madvise(map, size * sizeof(record), MADV_HUGEPAGE);
+		return static_cast<record*>(map);
+	}
+
+	std::size_t hashtable::count_used(void) const
+	{
+		std::size_t used = 0;
+
+		for (std::size_t i = 0; i < this->_size; ++i)
+		{
+			const record record = (*this)[i];
+			used += record.get_zobrist().key() &&
+				record.get_generation() == this->_generation;
+		}
+		return used;
+	}
+}
+
+// End of file
@@ -0,0 +1,135 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file hashtable.hpp
+ *  @brief Hash table of the alpha-beta search.
+ */
+
+#ifndef __HASHTABLE_HPP__
+#define __HASHTABLE_HPP__
+
+#include <cstddef>
+#include <string>
+#include "record.hpp"
+
+namespace checkers
+{
+	/** @class hashtable
+	 *  @brief The records of the searched positions, in the private
+	 *   memory of the process or in a named POSIX shared memory segment.
+	 *
+	 *  The slots are in buckets of two: a record is stored in the first
+	 *   slot when it is searched as deep as the record there, or that
+	 *   one is of the same position or of an earlier search, otherwise
+	 *   in the second slot.  So the deep records of the current search
+	 *   are kept, and the shallow ones replace each other.
+	 *
+	 *  The records are read and written without any lock, see record,
+	 *   so the threads and the processes sharing a table search on
+	 *   together.
+	 */
+	class hashtable
+	{
+	public:
+		/// Construct an empty table of @e size slots, in private memory.
+		explicit hashtable(std::size_t size);
+		~hashtable(void);
+
+		/// Get the number of the slots.
+		inline std::size_t size(void) const;
+		/// Get the record in the slot @e index.
+		inline record operator[](std::size_t index) const;
+		/** @brief Get the record in the slot of @e zobrist, which
+		 *   may be a record of another position.
+		 */
+		inline record probe(const zobrist& zobrist) const;
+		/// Store @e record in the bucket of its zobrist key.
+		inline void store(record record);
+		/** @brief Start loading the bucket of @e zobrist into the
+		 *   cache, to be probed soon.
+		 */
+		inline void prefetch(const zobrist& zobrist) const;
+
+		/** @brief Start a new search, the records of the earlier
+		 *   searches are replaced first.  The statistics are reset.
+		 */
+		inline void next_generation(void);
+		/// Get the number of the records stored by this search.
+		inline long unsigned int get_stores(void) const;
+		/** @brief Get the number of the records stored by this search
+		 *   in the first slot of the buckets.
+		 */
+		inline long unsigned int get_deep_stores(void) const;
+		/** @brief Get the number of the records of this search replaced
+		 *   by a record of another position.
+		 */
+		inline long unsigned int get_replaced(void) const;
+		/// Count the slots holding a record of this search.
+		std::size_t count_used(void) const;
+
+		/** @brief Back the table with the shared memory segment
+		 *   @e name, created empty unless it exists.  The records in
+		 *   the private memory are dropped.
+		 */
+		void share(const std::string& name);
+		/** @brief Change the table to an empty one of @e size slots,
+		 *   in private memory.
+		 */
+		void resize(std::size_t size);
+
+	private:
+		/// Define but not implement, to prevent object copy.
+		hashtable(const hashtable& rhs);
+		/// Define but not implement, to prevent object copy.
+		hashtable& operator=(const hashtable& rhs) const;
+
+		/// The slots of a bucket.
+		static const std::size_t BUCKET_SIZE = 2;
+
+		/** @brief Map an empty table of @e size slots in private
+		 *   memory, none for 0 slots.
+		 */
+		static record* allocate(std::size_t size);
+
+		/// Get the first slot of the bucket of @e zobrist.
+		inline std::size_t index(const zobrist& zobrist) const;
+		/** @brief Whether @e record is of this search, and of
+		 *   another position than @e zobrist.
+		 */
+		inline bool is_replaced(const record& record,
+			const zobrist& zobrist) const;
+		/// Add @e count to the statistic @e counter.
+		inline static void count(long unsigned int& counter,
+			long unsigned int count = 1);
+
+		std::size_t _size;
+		record* _records;
+		unsigned int _generation;
+		long unsigned int _stores;
+		long unsigned int _deep_stores;
+		long unsigned int _replaced;
+	};
+}
+
+#include "hashtable_i.hpp"
+#endif // __HASHTABLE_HPP__
+// End of file
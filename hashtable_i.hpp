@@ -0,0 +1,134 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file hashtable_i.hpp
+ *  @brief Hash table of the alpha-beta search.
+ */
+
+#ifndef __HASHTABLE_I_HPP__
+#define __HASHTABLE_I_HPP__
+
+namespace checkers
+{
+	inline std::size_t hashtable::size(void) const
+	{
+		return this->_size;
+	}
+
+	inline record hashtable::operator[](std::size_t index) const
+	{
+		return this->_records[index].load();
+	}
+
+	inline record hashtable::probe(const zobrist& zobrist) const
+	{
+		const record* bucket = this->_records + this->index(zobrist);
+		const record deep = bucket[0].load();
+
+		return deep.get_zobrist() == zobrist ? deep : bucket[1].load();
+	}
+
+	inline void hashtable::store(record record)
+	{
+		const zobrist key = record.get_zobrist();
+		checkers::record* bucket = this->_records + this->index(key);
+		const checkers::record deep = bucket[0].load();
+
+		record.set_generation(this->_generation);
+		hashtable::count(this->_stores);
+		if (deep.get_zobrist() == key ||
+			deep.get_generation() != this->_generation ||
+			deep.get_depth() <= record.get_depth())
+		{
+			hashtable::count(this->_replaced,
+				this->is_replaced(deep, key));
+			hashtable::count(this->_deep_stores);
+			bucket[0].store(record);
+		}
+		else
+		{
+			hashtable::count(this->_replaced,
+				this->is_replaced(bucket[1].load(), key));
+			bucket[1].store(record);
+		}
+	}
+
+	/**  Both records of a bucket are in a cache line.
+	 */
+	inline void hashtable::prefetch(const zobrist& zobrist) const
+	{
+		__builtin_prefetch(this->_records + this->index(zobrist));
+	}
+
+	/**  The generation wraps around in 16 searches.
+	 */
+	inline void hashtable::next_generation(void)
+	{
+		this->_generation = (this->_generation + 1) % 16;
+		this->_stores = 0;
+		this->_deep_stores = 0;
+		this->_replaced = 0;
+	}
+
+	inline long unsigned int hashtable::get_stores(void) const
+	{
+		return this->_stores;
+	}
+
+	inline long unsigned int hashtable::get_deep_stores(void) const
+	{
+		return this->_deep_stores;
+	}
+
+	inline long unsigned int hashtable::get_replaced(void) const
+	{
+		return this->_replaced;
+	}
+
+	inline std::size_t hashtable::index(const zobrist& zobrist) const
+	{
+		return zobrist.key() % (this->_size / hashtable::BUCKET_SIZE) *
+			hashtable::BUCKET_SIZE;
+	}
+
+	inline bool hashtable::is_replaced(const record& record,
+		const zobrist& zobrist) const
+	{
+		return record.get_zobrist().key() &&
+			record.get_zobrist() != zobrist &&
+			record.get_generation() == this->_generation;
+	}
+
+	/**  The threads of a search store in a table together, a count of
+	 *   another thread may be lost, but not the value torn.
+	 */
+	inline void hashtable::count(long unsigned int& counter,
+		long unsigned int count)
+	{
+		__atomic_store_n(&counter,
+			__atomic_load_n(&counter, __ATOMIC_RELAXED) + count,
+			__ATOMIC_RELAXED);
+	}
+}
+
+#endif // __HASHTABLE_I_HPP__
+// End of file
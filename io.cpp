@@ -118,6 +118,15 @@ namespace checkers
 
 	// ================================================================
 
+	/**  The descriptors are shared with the standard streams, which the
+	 *   batch modes read and write instead.
+	 */
+	void io::block(void)
+	{
+		this->clrfl(this->_in_fd,  O_NONBLOCK);
+		this->clrfl(this->_out_fd, O_NONBLOCK);
+	}
+
 	/** @param fd is the open file descriptor
 	 *  @param flags are file status flags to turn on
 	 */
@@ -140,6 +149,29 @@ namespace checkers
 			throw std::runtime_error("fcntl() failed");
 		}
 	}
+
+	/** @param fd is the open file descriptor
+	 *  @param flags are file status flags to turn off
+	 */
+	void io::clrfl(int fd, int flags)
+	{
+		int val;
+
+		if ((val = fcntl(fd, F_GETFL, 0)) < 0)
+		{
+			/// @throw std::runtime_error when fcntl() failed.
+			throw std::runtime_error("fcntl() failed");
+		}
+
+		// Turn off flags
+		val &= ~flags;
+
+		if (fcntl(fd, F_SETFL, val) < 0)
+		{
+			/// @throw std::runtime_error when fcntl() failed.
+			throw std::runtime_error("fcntl() failed");
+		}
+	}
 }
 
 // End of file
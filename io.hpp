@@ -52,6 +52,8 @@ namespace checkers
 
 		/// Get a new line from read buffer
 		io& operator >>(std::string& rhs);
+		/// Get a new line from read buffer, but leave it there
+		inline std::string peekline(void) const;
 
 		inline int lines_to_read(void);
 		inline bool eof(void) const;
@@ -59,6 +61,9 @@ namespace checkers
 		static io& flush(io& io);
 		static inline io& endl(io& io);
 
+		/// Turn back to blocking I/O, for the standard streams.
+		void block(void);
+
 	private:
 		/// Define but not implement, to prevent object copy.
 		io(const io& rhs);
@@ -71,6 +76,7 @@ namespace checkers
 		int _out_fd;
 
 		void setfl(int fd, int flags);
+		void clrfl(int fd, int flags);
 	};
 }
 
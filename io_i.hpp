@@ -41,6 +41,11 @@ namespace checkers
 		return *this;
 	}
 
+	inline std::string io::peekline(void) const
+	{
+		return this->_read_buf.peekline();
+	}
+
 	inline int io::lines_to_read(void)
 	{
 		return this->_read_buf.lines();
@@ -167,6 +167,28 @@ namespace checkers
 		return line;
 	}
 
+	/** @return a entire line from the loop buffer as getline(), but
+	 *   leave the line in the loop buffer.
+	 */
+	std::string loopbuffer::peekline(void) const
+	{
+		char c;
+		std::string line;
+
+		if (this->_lines)
+		{
+			unsigned int pos = this->_front;
+			do
+			{
+				c = this->_buffer[pos];
+				line += c;
+				pos = (pos + 1) % this->_max_size;
+			} while ('\n' != c);
+		}
+
+		return line;
+	}
+
 	void loopbuffer::push_back(char c)
 	{
 		if (this->is_full())
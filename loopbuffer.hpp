@@ -49,6 +49,8 @@ namespace checkers
 		void write(int fd);
 
 		std::string getline(void);
+		/// Get a line without removing it from the loop buffer.
+		std::string peekline(void) const;
 		void push_back(char c);
 		void push_back(const std::string& str);
 		void push_back(const char* s);
@@ -0,0 +1,59 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file packedboard.hpp
+ *  @brief Game board packed into 32-bit unsigned integers.
+ */
+
+#ifndef __PACKEDBOARD_HPP__
+#define __PACKEDBOARD_HPP__
+
+extern "C"
+{
+	#include <stdint.h>
+}
+#include "board.hpp"
+
+namespace checkers
+{
+	/** @struct packed_board
+	 *  @brief The pieces and the player on move of a game board, as plain
+	 *   32-bit unsigned integers for the batch operations.
+	 */
+	struct packed_board
+	{
+		/// Pack a game board.
+		inline static packed_board pack(const board& board);
+		/// Unpack the game board.
+		inline board unpack(void) const;
+
+		uint32_t black_pieces;
+		uint32_t white_pieces;
+		uint32_t kings;
+		/// 1 when the player has dark pieces is on move, otherwise 0.
+		uint32_t black_to_move;
+	};
+}
+
+#include "packedboard_i.hpp"
+#endif // __PACKEDBOARD_HPP__
+// End of file
@@ -0,0 +1,54 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file packedboard_i.hpp
+ *  @brief Game board packed into 32-bit unsigned integers.
+ */
+
+#ifndef __PACKEDBOARD_I_HPP__
+#define __PACKEDBOARD_I_HPP__
+
+namespace checkers
+{
+	inline packed_board packed_board::pack(const board& board)
+	{
+		packed_board packed =
+		{
+			board.get_black_pieces().get_bits(),
+			board.get_white_pieces().get_bits(),
+			board.get_kings().get_bits(),
+			board.is_black_to_move()
+		};
+
+		return packed;
+	}
+
+	inline board packed_board::unpack(void) const
+	{
+		return board(bitboard(this->black_pieces),
+			bitboard(this->white_pieces), bitboard(this->kings),
+			this->black_to_move);
+	}
+}
+
+#endif // __PACKEDBOARD_I_HPP__
+// End of file
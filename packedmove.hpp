@@ -0,0 +1,122 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file packedmove.hpp
+ *  @brief Move packed into a 32-bit unsigned integer.
+ */
+
+#ifndef __PACKEDMOVE_HPP__
+#define __PACKEDMOVE_HPP__
+
+extern "C"
+{
+	#include <stdint.h>
+}
+#include <ostream>
+#include "move.hpp"
+
+namespace checkers
+{
+	/** @class packed_move
+	 *  @brief A move packed into a 32-bit unsigned integer, used by the
+	 *   move generator, the search and the hash table.
+	 *
+	 *  @verbatim
+	     bit  0 -  4  square number of the source square
+	     bit  5 -  9  square number of the destination square
+	     bit 10 - 14  square number of the captured piece
+	     bit 15       capture a piece
+	     bit 16       capture a king
+	     bit 17       crown @endverbatim
+	 */
+	class packed_move
+	{
+	public:
+		/// Construct a null move, which matches no legal move.
+		inline packed_move(void);
+		/// Pack a move.
+		explicit inline packed_move(const move& move);
+		/// Construct from the 32-bit unsigned integer of a packed move.
+		explicit inline packed_move(uint32_t packed);
+		/// Pack the squares of a move.
+		inline packed_move(bitboard src, bitboard dest,
+			bitboard capture, bool will_capture_a_king,
+			bool will_crown);
+
+		/// Get the source square of the move.
+		inline bitboard get_src(void) const;
+		/// Get the destination square of the move.
+		inline bitboard get_dest(void) const;
+		/// Get the square of the captured piece.
+		inline bitboard get_capture(void) const;
+		/// Get the number, 0 - 31, of the source square.
+		inline unsigned int get_src_square(void) const;
+		/// Get the number, 0 - 31, of the destination square.
+		inline unsigned int get_dest_square(void) const;
+		/** @brief Get the number of the square of the captured piece,
+		 *   0 without a capture.
+		 */
+		inline unsigned int get_capture_square(void) const;
+
+		/// Whether this move will capture a king.
+		inline bool will_capture_a_king(void) const;
+		/// Whether this move will crown.
+		inline bool will_crown(void) const;
+
+		/// Get the 32-bit unsigned integer of the packed move.
+		inline uint32_t get_packed(void) const;
+
+		/// Unpack the move.
+		inline operator move(void) const;
+
+		friend bool operator ==(const packed_move& lhs,
+			const packed_move& rhs);
+
+	private:
+		static const unsigned int SRC_SHIFT     = 0;
+		static const unsigned int DEST_SHIFT    = 5;
+		static const unsigned int CAPTURE_SHIFT = 10;
+		static const uint32_t SQUARE_MASK     = 0x1fU;
+		static const uint32_t CAPTURE_FLAG    = 0x1U << 15;
+		static const uint32_t CAPTURE_A_KING  = 0x1U << 16;
+		static const uint32_t CROWN           = 0x1U << 17;
+		/// The null move, the source is the same as the destination.
+		static const uint32_t NULL_MOVE       = 0x0U;
+
+		/// The 32-bit unsigned integer to hold the packed move.
+		uint32_t _move;
+	};
+
+	/// Relational ``equal to''.
+	inline bool operator ==(const packed_move& lhs,
+		const packed_move& rhs);
+	/// Relational ``not equal to''.
+	inline bool operator !=(const packed_move& lhs,
+		const packed_move& rhs);
+
+	/// Stream out the move.
+	std::ostream& operator <<(std::ostream& os, const packed_move& rhs);
+}
+
+#include "packedmove_i.hpp"
+#endif // __PACKEDMOVE_HPP__
+// End of file
@@ -0,0 +1,149 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file packedmove_i.hpp
+ *  @brief Move packed into a 32-bit unsigned integer.
+ */
+
+#ifndef __PACKEDMOVE_I_HPP__
+#define __PACKEDMOVE_I_HPP__
+
+#include <cassert>
+
+namespace checkers
+{
+	inline packed_move::packed_move(void) :
+		_move(packed_move::NULL_MOVE)
+	{
+	}
+
+	inline packed_move::packed_move(const move& move) :
+		_move(packed_move::NULL_MOVE)
+	{
+		*this = packed_move(move.get_src(), move.get_dest(),
+			move.get_capture(), move.will_capture_a_king(),
+			move.will_crown());
+	}
+
+	inline packed_move::packed_move(uint32_t packed) :
+		_move(packed)
+	{
+	}
+
+	inline packed_move::packed_move(bitboard src, bitboard dest,
+		bitboard capture, bool will_capture_a_king, bool will_crown) :
+		_move(src.ntz() << packed_move::SRC_SHIFT |
+			dest.ntz() << packed_move::DEST_SHIFT)
+	{
+		assert(1 == src.count());
+		assert(1 == dest.count());
+
+		if (capture)
+		{
+			this->_move |= capture.ntz() <<
+				packed_move::CAPTURE_SHIFT |
+				packed_move::CAPTURE_FLAG;
+		}
+		if (will_capture_a_king)
+		{
+			this->_move |= packed_move::CAPTURE_A_KING;
+		}
+		if (will_crown)
+		{
+			this->_move |= packed_move::CROWN;
+		}
+	}
+
+	inline bitboard packed_move::get_src(void) const
+	{
+		return bitboard(0x1U << (this->_move >> packed_move::SRC_SHIFT
+			& packed_move::SQUARE_MASK));
+	}
+
+	inline bitboard packed_move::get_dest(void) const
+	{
+		return bitboard(0x1U << (this->_move >> packed_move::DEST_SHIFT
+			& packed_move::SQUARE_MASK));
+	}
+
+	inline bitboard packed_move::get_capture(void) const
+	{
+		return bitboard((this->_move & packed_move::CAPTURE_FLAG) ?
+			0x1U << (this->_move >> packed_move::CAPTURE_SHIFT
+			& packed_move::SQUARE_MASK) : bitboard::EMPTY);
+	}
+
+	inline unsigned int packed_move::get_src_square(void) const
+	{
+		return this->_move >> packed_move::SRC_SHIFT &
+			packed_move::SQUARE_MASK;
+	}
+
+	inline unsigned int packed_move::get_dest_square(void) const
+	{
+		return this->_move >> packed_move::DEST_SHIFT &
+			packed_move::SQUARE_MASK;
+	}
+
+	inline unsigned int packed_move::get_capture_square(void) const
+	{
+		return this->_move >> packed_move::CAPTURE_SHIFT &
+			packed_move::SQUARE_MASK;
+	}
+
+	inline bool packed_move::will_capture_a_king(void) const
+	{
+		return this->_move & packed_move::CAPTURE_A_KING;
+	}
+
+	inline bool packed_move::will_crown(void) const
+	{
+		return this->_move & packed_move::CROWN;
+	}
+
+	inline uint32_t packed_move::get_packed(void) const
+	{
+		return this->_move;
+	}
+
+	inline packed_move::operator move(void) const
+	{
+		assert(packed_move::NULL_MOVE != this->_move);
+
+		return move(this->get_src(), this->get_dest(),
+			this->get_capture(), this->will_capture_a_king(),
+			this->will_crown());
+	}
+
+	inline bool operator ==(const packed_move& lhs, const packed_move& rhs)
+	{
+		return lhs._move == rhs._move;
+	}
+
+	inline bool operator !=(const packed_move& lhs, const packed_move& rhs)
+	{
+		return !(lhs == rhs);
+	}
+}
+
+#endif // __PACKEDMOVE_I_HPP__
+// End of file
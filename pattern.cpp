@@ -0,0 +1,200 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file pattern.cpp
+ *  @brief Evaluate the patterns of small regions by lookup tables.
+ */
+
+#include "pattern.hpp"
+
+namespace checkers
+{
+	const uint32_t pattern::_regions[pattern::REGIONS] =
+	{
+		0x0000cccc,	// Lower left corner
+		0x00003333,	// Lower right corner
+		0x00666600,	// Center
+		0xcccc0000,	// Upper left corner
+		0x33330000	// Upper right corner
+	};
+
+	const std::vector<unsigned int> pattern::_base5(pattern::build_base5());
+	const std::vector<int16_t> pattern::_table(pattern::build_table());
+
+	/**  A square is indexed as a base 5 digit, 0 for empty, 1 for dark
+	 *   man, 2 for light man, 3 for dark king and 4 for light king, which
+	 *   is the sum of the dark bit, 2 times the light bit, and 2 times the
+	 *   king bit.
+	 */
+	int pattern::evaluate(uint32_t black_pieces, uint32_t white_pieces,
+		uint32_t kings)
+	{
+		int val = 0;
+		unsigned int i;
+
+		for (i = 0; i < pattern::REGIONS; ++i)
+		{
+			uint32_t black = pattern::gather(black_pieces,
+				pattern::_regions[i]);
+			uint32_t white = pattern::gather(white_pieces,
+				pattern::_regions[i]);
+			uint32_t king = pattern::gather(kings,
+				pattern::_regions[i]);
+
+			val += pattern::_table[pattern::_base5[black] +
+				2 * pattern::_base5[white] +
+				2 * pattern::_base5[king]];
+		}
+
+		return val;
+	}
+
+	// ================================================================
+
+	std::vector<int16_t> pattern::build_table(void)
+	{
+		std::vector<int16_t> table(pattern::PATTERNS);
+		unsigned int i;
+
+		for (i = 0; i < pattern::PATTERNS; ++i)
+		{
+			table[i] = pattern::score(i);
+		}
+
+		return table;
+	}
+
+	std::vector<unsigned int> pattern::build_base5(void)
+	{
+		std::vector<unsigned int> base5(0x1U << pattern::SQUARES);
+		unsigned int i;
+		unsigned int j;
+
+		for (i = 0; i < base5.size(); ++i)
+		{
+			unsigned int digit = 1;
+			for (j = 0; j < pattern::SQUARES; ++j, digit *= 5)
+			{
+				if (i & 0x1U << j)
+				{
+					base5[i] += digit;
+				}
+			}
+		}
+
+		return base5;
+	}
+
+	int pattern::score(unsigned int index)
+	{
+		int grid[4][4] = { { pattern::EMPTY } };
+		unsigned int i;
+		int row;
+		int col;
+		int val = 0;
+
+		for (i = 0; i < pattern::SQUARES; ++i, index /= 5)
+		{
+			row = i / 2;
+			col = (row % 2 ? 1 : 0) + (i % 2 ? 0 : 2);
+			grid[row][col] = index % 5;
+		}
+
+		for (row = 0; row < 4; ++row)
+		{
+			for (col = 0; col < 4; ++col)
+			{
+				if (pattern::EMPTY != grid[row][col])
+				{
+					val += pattern::score(grid, row, col);
+				}
+			}
+		}
+
+		return val;
+	}
+
+	/**  Only the squares inside the region are considered, a piece
+	 *   next to the region is neither a support nor an attacker.
+	 */
+	int pattern::score(const int grid[4][4], int row, int col)
+	{
+		const int piece = grid[row][col];
+		const bool black = pattern::is_black(piece);
+		const int sign = black ? 1 : -1;
+		int val = 0;
+		bool exposed = false;
+		int dr;
+		int dc;
+
+		for (dr = -1; dr <= 1; dr += 2)
+		{
+			for (dc = -1; dc <= 1; dc += 2)
+			{
+				if (!pattern::is_inside(row + dr, col + dc))
+				{
+					continue;
+				}
+				const int other = grid[row + dr][col + dc];
+				if (pattern::EMPTY == other)
+				{
+					continue;
+				}
+
+				if (black == pattern::is_black(other))
+				{
+					// A man supported from behind
+					if ((pattern::BLACK_MAN == piece &&
+						-1 == dr) ||
+						(pattern::WHITE_MAN == piece &&
+						1 == dr))
+					{
+						val += sign *
+							pattern::SUPPORTED;
+					}
+				}
+				else if (pattern::is_inside(row - dr,
+					col - dc) &&
+					pattern::EMPTY ==
+					grid[row - dr][col - dc] &&
+					!(pattern::BLACK_MAN == other &&
+					1 == dr) &&
+					!(pattern::WHITE_MAN == other &&
+					-1 == dr))
+				{
+					// The enemy can jump over to the
+					// empty square behind
+					exposed = true;
+				}
+			}
+		}
+
+		if (exposed)
+		{
+			val += sign * pattern::EXPOSED;
+		}
+
+		return val;
+	}
+}
+
+// End of file
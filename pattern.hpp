@@ -0,0 +1,117 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file pattern.hpp
+ *  @brief Evaluate the patterns of small regions by lookup tables.
+ */
+
+#ifndef __PATTERN_HPP__
+#define __PATTERN_HPP__
+
+extern "C"
+{
+	#include <stdint.h>
+}
+#include <vector>
+#include "board.hpp"
+
+namespace checkers
+{
+	/** @class pattern
+	 *  @brief The 8 dark squares of a 4x4 region of the game board are
+	 *   gathered from the bitboards, and indexed into a precomputed
+	 *   table by the 5 states of each square: empty, dark man, light
+	 *   man, dark king and light king.
+	 *
+	 *   The regions are the 4 corners and the center of the game board.
+	 *   The squares of all the regions are in the same order, so they
+	 *   share one table, which scores the pieces supported from behind,
+	 *   and the pieces exposed to a jump.
+	 *
+	 *  @verbatim
+	     +---+---+---+---+
+	     |   | 7 |   | 6 |  row 3
+	     +---+---+---+---+
+	     | 5 |   | 4 |   |  row 2
+	     +---+---+---+---+
+	     |   | 3 |   | 2 |  row 1
+	     +---+---+---+---+
+	     | 1 |   | 0 |   |  row 0
+	     +---+---+---+---+ @endverbatim
+	 */
+	class pattern
+	{
+	public:
+		/// Get the value of the patterns for the dark pieces.
+		inline static int evaluate(const board& board);
+		/** @overload int evaluate(const board&)
+		 */
+		static int evaluate(uint32_t black_pieces,
+			uint32_t white_pieces, uint32_t kings);
+
+		/// The value of a piece supported from behind.
+		static const int SUPPORTED = 4;
+		/// The value of a piece exposed to a jump.
+		static const int EXPOSED   = -16;
+
+	private:
+		/// Gather the bits of @e x selected by @e mask to the lowest.
+		inline static uint32_t gather(uint32_t x, uint32_t mask);
+
+		/// Build the table of all the patterns.
+		static std::vector<int16_t> build_table(void);
+		/// Build the table to convert 8 bits into base 5 digits.
+		static std::vector<unsigned int> build_base5(void);
+		/// The state of a square.
+		enum state
+		{
+			EMPTY = 0,
+			BLACK_MAN,
+			WHITE_MAN,
+			BLACK_KING,
+			WHITE_KING
+		};
+
+		/// Score a pattern of 8 squares.
+		static int score(unsigned int index);
+		/// Score a piece of the pattern on a 4x4 grid.
+		static int score(const int grid[4][4], int row, int col);
+		inline static bool is_black(int piece);
+		inline static bool is_inside(int row, int col);
+
+		/// The number of squares of a pattern.
+		static const unsigned int SQUARES = 8;
+		/// The number of patterns, 5 to the power of 8.
+		static const unsigned int PATTERNS = 390625;
+		/// The number of regions.
+		static const unsigned int REGIONS = 5;
+		/// The squares of the regions.
+		static const uint32_t _regions[REGIONS];
+
+		static const std::vector<unsigned int> _base5;
+		static const std::vector<int16_t> _table;
+	};
+}
+
+#include "pattern_i.hpp"
+#endif // __PATTERN_HPP__
+// End of file
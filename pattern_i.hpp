@@ -0,0 +1,81 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file pattern_i.hpp
+ *  @brief Evaluate the patterns of small regions by lookup tables.
+ */
+
+#ifndef __PATTERN_I_HPP__
+#define __PATTERN_I_HPP__
+
+#ifdef __BMI2__
+extern "C"
+{
+	#include <immintrin.h>
+}
+#endif
+
+namespace checkers
+{
+	inline int pattern::evaluate(const board& board)
+	{
+		return pattern::evaluate(board.get_black_pieces().get_bits(),
+			board.get_white_pieces().get_bits(),
+			board.get_kings().get_bits());
+	}
+
+	/**  Use the instruction PEXT if available.
+	 */
+	inline uint32_t pattern::gather(uint32_t x, uint32_t mask)
+	{
+#ifdef __BMI2__
+		return _pext_u32(x, mask);
+#else
+		uint32_t result = 0;
+		uint32_t bit = 1;
+
+		for (; mask; mask &= mask - 1, bit <<= 1)
+		{
+			if (x & mask & -mask)
+			{
+				result |= bit;
+			}
+		}
+
+		return result;
+#endif
+	}
+
+	inline bool pattern::is_black(int piece)
+	{
+		return pattern::BLACK_MAN == piece ||
+			pattern::BLACK_KING == piece;
+	}
+
+	inline bool pattern::is_inside(int row, int col)
+	{
+		return row >= 0 && row < 4 && col >= 0 && col < 4;
+	}
+}
+
+#endif // __PATTERN_I_HPP__
+// End of file
@@ -24,8 +24,15 @@
  *  @brief The main program of the checers engine.
  */
 
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include "absearch.hpp"
+#include "batch.hpp"
 #include "engine.hpp"
+#include "evaluate.hpp"
+#include "nonstdio.hpp"
+#include "selfplay.hpp"
 #include "signal.hpp"
 
 /** @mainpage Ponder, a English/American Checkers Game
@@ -131,7 +138,33 @@
      English draughts board with all pieces on starting position @endverbatim
  *
  */
-int main(void)
+void usage(void)
+{
+	std::cerr
+		<< "Usage: ponder [--analyze-file FILE] [--selfplay GAMES"
+			" [--random-plies N]\n"
+		<< "                [--nodes NODES] [--output FILE]]"
+			" [--depth DEPTH]\n"
+		<< "                [--threads N]"
+			" [--weights FILE] [--hash-size MB]\n"
+		<< "                [--shared-hash NAME]\n"
+		<< std::flush;
+}
+
+/// Get a number of option @e name in [@e min, @e max], or exit.
+int get_option(const char* name, const char* arg, int min, int max)
+{
+	int v = std::strtol(arg, NULL, 10);
+	if (v < min || v > max)
+	{
+		std::cerr << "Error: Invalid " << name << std::endl;
+		std::exit(255);
+	}
+
+	return v;
+}
+
+int main(int argc, char* argv[])
 {
 	try
 	{
@@ -144,7 +177,137 @@ int main(void)
 		checkers::signal(SIGSEGV, &checkers::crash_handler);
 		checkers::signal(SIGTRAP, &checkers::crash_handler);
 
-		checkers::engine::init().run();
+		std::string file;
+		std::string output("-");
+		int games = 0;
+		int random_plies = 8;
+		int nodes = 0;
+		int depth = 0;
+		int threads = 1;
+		int i = 0;
+
+		while (++i < argc)
+		{
+			if ("--analyze-file" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				file = argv[i];
+			}
+			else if ("--selfplay" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				games = get_option("games", argv[i], 1,
+					999999999);
+			}
+			else if ("--random-plies" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				random_plies = get_option("random plies",
+					argv[i], 0, 99);
+			}
+			else if ("--nodes" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				nodes = get_option("nodes", argv[i], 1,
+					999999999);
+			}
+			else if ("--output" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				output = argv[i];
+			}
+			else if ("--weights" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				std::ifstream ifs(argv[i]);
+				if (!ifs)
+				{
+					std::cerr << "Error: Cannot open "
+						<< argv[i] << std::endl;
+					std::exit(255);
+				}
+				checkers::evaluate::load_weights(ifs);
+			}
+			else if ("--depth" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				depth = get_option("depth", argv[i], 1, 99);
+			}
+			else if ("--hash-size" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				checkers::absearch::set_hash_size(get_option(
+					"hash size", argv[i], 1, 65536));
+			}
+			else if ("--shared-hash" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				checkers::absearch::share_hash(argv[i]);
+			}
+			else if ("--threads" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				threads = get_option("threads", argv[i], 1,
+					256);
+			}
+			else
+			{
+				usage();
+				std::exit(255);
+			}
+		}
+
+		if ((!file.empty() && games) || (nodes && !games))
+		{
+			usage();
+			std::exit(255);
+		}
+
+		if (!file.empty())
+		{
+			// Read positions from the standard input with ``-''
+			checkers::nio.block();
+			std::ifstream ifs;
+			if ("-" != file)
+			{
+				ifs.open(file.c_str());
+				if (!ifs)
+				{
+					std::cerr << "Error: Cannot open "
+						<< file << std::endl;
+					std::exit(255);
+				}
+			}
+			checkers::batch batch("-" == file ? std::cin : ifs,
+				std::cout, depth ? depth : 10);
+			batch.run(threads);
+		}
+		else if (games)
+		{
+			// Write samples to the standard output with ``-''
+			checkers::nio.block();
+			std::ofstream ofs;
+			if ("-" != output)
+			{
+				ofs.open(output.c_str(), std::ios::binary);
+				if (!ofs)
+				{
+					std::cerr << "Error: Cannot open "
+						<< output << std::endl;
+					std::exit(255);
+				}
+			}
+			// The depth is not limited by default with NODES
+			checkers::selfplay selfplay("-" == output ?
+				std::cout : ofs, games,
+				depth ? depth : nodes ? 99 : 6, random_plies,
+				nodes);
+			selfplay.run(threads);
+		}
+		else
+		{
+			checkers::engine::init().run();
+		}
 	}
 	catch (std::exception& e)
 	{
@@ -29,23 +29,24 @@
 namespace checkers
 {
 	int record::get_val(unsigned int depth, int alpha, int beta,
-		std::vector<move>& best_moves) const
+		unsigned int ply) const
 	{
-		if (this->_depth >= depth)
+		if (this->get_depth() >= depth)
 		{
-			if (EXACT == this->_flag)
+			const int val = evaluate::to_root(static_cast<int32_t>(
+				static_cast<uint32_t>(this->_data)), ply);
+			const hash_flag flag = this->get_flag();
+
+			if (EXACT == flag)
 			{
-				best_moves = this->_best_moves;
-				return this->_val;
+				return val;
 			}
-			if (ALPHA == this->_flag && this->_val <= alpha)
+			if (ALPHA == flag && val <= alpha)
 			{
-				best_moves = this->_best_moves;
 				return alpha;
 			}
-			if (BETA  == this->_flag && this->_val >= beta)
+			if (BETA  == flag && val >= beta)
 			{
-				best_moves = this->_best_moves;
 				return beta;
 			}
 		}
@@ -54,6 +55,63 @@ namespace checkers
 		 */
 		return evaluate::unknown();
 	}
+
+	/**  A record is 18 bytes in little-endian byte order: the 64-bit
+	 *   zobrist key, the 32-bit value, one byte each of the depth and the
+	 *   flag, then the 32-bit packed best move.
+	 */
+	std::size_t record::read(const unsigned char* buf, std::size_t size)
+	{
+		if (size < record::SIZE)
+		{
+			return 0;
+		}
+
+		uint64_t key = 0;
+		uint32_t val = 0;
+		uint32_t move = 0;
+		unsigned int i;
+
+		for (i = 0; i < 8; ++i)
+		{
+			key |= uint64_t(buf[i]) << i * 8;
+		}
+		for (i = 0; i < 4; ++i)
+		{
+			val |= uint32_t(buf[8 + i]) << i * 8;
+			move |= uint32_t(buf[14 + i]) << i * 8;
+		}
+
+		*this = record(zobrist(key), buf[12],
+			static_cast<int32_t>(val),
+			static_cast<hash_flag>(buf[13] % (BETA + 1)),
+			packed_move(move & record::MOVE_MASK));
+
+		return record::SIZE;
+	}
+
+	void record::write(std::ostream& os) const
+	{
+		unsigned char buf[record::SIZE];
+		const uint64_t key = this->get_zobrist().key();
+		const uint32_t val = static_cast<uint32_t>(this->_data);
+		const uint32_t move = this->get_best_move().get_packed();
+		unsigned int i;
+
+		for (i = 0; i < 8; ++i)
+		{
+			buf[i] = key >> i * 8 & 0xff;
+		}
+		for (i = 0; i < 4; ++i)
+		{
+			buf[8 + i] = val >> i * 8 & 0xff;
+			buf[14 + i] = move >> i * 8 & 0xff;
+		}
+		buf[12] = this->get_depth();
+		buf[13] = this->get_flag();
+
+		os.write(reinterpret_cast<const char*>(buf), record::SIZE);
+	}
 }
 
 // End of file
@@ -27,12 +27,29 @@
 #ifndef __RECORD_HPP_
 #define __RECORD_HPP_
 
+#include <cstddef>
+#include <ostream>
 #include "evaluate.hpp"
-#include "move.hpp"
+#include "packedmove.hpp"
 #include "zobrist.hpp"
 
 namespace checkers
 {
+	/** @class record
+	 *  @brief A record of the hash table, two 64-bit words without any
+	 *   pointer, which may be placed in the memory shared by processes.
+	 *
+	 *  The first word is the zobrist key xor the second, so a record
+	 *   half written by another thread or process is read with a wrong
+	 *   key, and ignored as a record of another position.
+	 *
+	 *  @verbatim
+	     bit  0 - 31  value
+	     bit 32 - 49  packed best move
+	     bit 50 - 57  depth
+	     bit 58 - 59  flag
+	     bit 60 - 63  generation @endverbatim
+	 */
 	class record
 	{
 	public:
@@ -48,20 +65,55 @@ namespace checkers
 
 		inline record(void);
 		inline record(zobrist zobrist, unsigned int depth, int val,
-			hash_flag flag);
-		inline record(zobrist zobrist, unsigned int depth, int val,
-			hash_flag flag, const std::vector<move>& best_moves);
+			hash_flag flag, packed_move best_move = packed_move());
 
 		inline zobrist get_zobrist(void) const;
+		inline unsigned int get_depth(void) const;
+		inline hash_flag get_flag(void) const;
+		inline packed_move get_best_move(void) const;
+		/// Get the generation of the search which stored the record.
+		inline unsigned int get_generation(void) const;
+		inline void set_generation(unsigned int generation);
+		/** @brief Get the value for the search of @e depth in the
+		 *   window of @e alpha and @e beta, at a node @e ply deep.
+		 *   The value is saved as won or lost from the node, see
+		 *   evaluate::from_root().
+		 */
 		int get_val(unsigned int depth, int alpha, int beta,
-			std::vector<move>& best_moves) const;
+			unsigned int ply) const;
+
+		/** @brief Read the record in place, once each word, while
+		 *   it may be written concurrently.
+		 */
+		inline record load(void) const;
+		/** @brief Write @e record in place, once each word, while
+		 *   it may be read concurrently.
+		 */
+		inline void store(const record& record);
+
+		/** @brief Read a record from @e size bytes at @e buf.
+		 *  @return The bytes read, or 0 when @e size is too small.
+		 */
+		std::size_t read(const unsigned char* buf, std::size_t size);
+		/// Write the record in the binary format of read().
+		void write(std::ostream& os) const;
 
 	private:
-		zobrist _zobrist;
-		unsigned int _depth;
-		int _val;
-		hash_flag _flag;
-		std::vector<move> _best_moves;
+		static const unsigned int MOVE_SHIFT  = 32;
+		static const unsigned int DEPTH_SHIFT = 50;
+		static const unsigned int FLAG_SHIFT  = 58;
+		static const unsigned int GENERATION_SHIFT = 60;
+		static const uint64_t MOVE_MASK  = 0x3ffffU;
+		static const uint64_t DEPTH_MASK = 0xffU;
+		static const uint64_t FLAG_MASK  = 0x3U;
+		static const uint64_t GENERATION_MASK = 0xfU;
+
+		/// The size of a record in the binary format.
+		static const std::size_t SIZE = 18;
+
+		/// The zobrist key xor the data.
+		uint64_t _check;
+		uint64_t _data;
 	};
 }
 
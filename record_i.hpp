@@ -27,30 +27,79 @@
 #ifndef __RECORD_I_HPP__
 #define __RECORD_I_HPP__
 
+#include <algorithm>
+
 namespace checkers
 {
 	inline record::record(void) :
-		_zobrist(), _depth(0U), _val(0), _flag(EXACT), _best_moves()
+		_check(0), _data(0)
 	{
 	}
 
+	/**  The depth is saturated to a byte.
+	 */
 	inline record::record(zobrist zobrist, unsigned int depth, int val,
-		hash_flag flag) :
-		_zobrist(zobrist), _depth(depth), _val(val), _flag(flag),
-		_best_moves()
+		hash_flag flag, packed_move best_move) :
+		_check(0),
+		_data(uint64_t(static_cast<uint32_t>(val)) |
+			uint64_t(best_move.get_packed()) << record::MOVE_SHIFT |
+			uint64_t(std::min(depth, 255U)) << record::DEPTH_SHIFT |
+			uint64_t(flag) << record::FLAG_SHIFT)
 	{
+		this->_check = zobrist.key() ^ this->_data;
 	}
 
-	inline record::record(zobrist zobrist, unsigned int depth, int val,
-		hash_flag flag, const std::vector<move>& best_moves) :
-		_zobrist(zobrist), _depth(depth), _val(val), _flag(flag),
-		_best_moves(best_moves)
+	inline zobrist record::get_zobrist(void) const
 	{
+		return zobrist(this->_check ^ this->_data);
 	}
 
-	inline zobrist record::get_zobrist(void) const
+	inline unsigned int record::get_depth(void) const
+	{
+		return this->_data >> record::DEPTH_SHIFT & record::DEPTH_MASK;
+	}
+
+	inline record::hash_flag record::get_flag(void) const
+	{
+		return static_cast<hash_flag>(
+			this->_data >> record::FLAG_SHIFT & record::FLAG_MASK);
+	}
+
+	inline packed_move record::get_best_move(void) const
+	{
+		return packed_move(static_cast<uint32_t>(
+			this->_data >> record::MOVE_SHIFT & record::MOVE_MASK));
+	}
+
+	inline unsigned int record::get_generation(void) const
+	{
+		return this->_data >> record::GENERATION_SHIFT &
+			record::GENERATION_MASK;
+	}
+
+	inline void record::set_generation(unsigned int generation)
+	{
+		const uint64_t key = this->_check ^ this->_data;
+
+		this->_data = (this->_data & ~(record::GENERATION_MASK <<
+			record::GENERATION_SHIFT)) | uint64_t(generation &
+			record::GENERATION_MASK) << record::GENERATION_SHIFT;
+		this->_check = key ^ this->_data;
+	}
+
+	inline record record::load(void) const
+	{
+		record record;
+
+		record._check = __atomic_load_n(&this->_check, __ATOMIC_RELAXED);
+		record._data = __atomic_load_n(&this->_data, __ATOMIC_RELAXED);
+		return record;
+	}
+
+	inline void record::store(const record& record)
 	{
-		return this->_zobrist;
+		__atomic_store_n(&this->_check, record._check, __ATOMIC_RELAXED);
+		__atomic_store_n(&this->_data, record._data, __ATOMIC_RELAXED);
 	}
 }
 
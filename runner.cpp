@@ -28,6 +28,7 @@
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
+#include "board.hpp"
 #include "io.hpp"
 #include "signal.hpp"
 #include "pipe.hpp"
@@ -39,6 +40,16 @@ void usage(void)
 		<< std::flush;
 }
 
+/**  Follow the game on a board of the runner.
+ *  @return Whether the game is a draw by the 40-move rule.
+ */
+bool make_move(checkers::board& board, const std::string& move)
+{
+	board.make_move(board.parse_move(move));
+	return board.get_reversible_moves() >=
+		checkers::board::REVERSIBLE_MOVES_LIMIT;
+}
+
 int main(int argc, char* argv[])
 {
 	try
@@ -97,6 +108,7 @@ int main(int argc, char* argv[])
 		std::string line_white;
 		std::string move;
 		int moves = 0;
+		checkers::board board;
 	
 		io_black << "st " << second << '\n';
 		io_white << "st " << second << '\n';
@@ -143,7 +155,8 @@ int main(int argc, char* argv[])
 						<< checkers::io::flush;
 					io_white << move << '\n' << checkers::io::flush;
 					++moves;
-					if (moves > moves_limit)
+					if (moves > moves_limit ||
+						make_move(board, move))
 					{
 						io << "***** 1/2-1/2 (Draw) ***\n"
 							<< checkers::io::flush;
@@ -185,7 +198,8 @@ int main(int argc, char* argv[])
 						<< checkers::io::flush;
 					io_black << move << '\n' << checkers::io::flush;
 					++moves;
-					if (moves > moves_limit)
+					if (moves > moves_limit ||
+						make_move(board, move))
 					{
 						io << "***** 1/2-1/2 (Draw) ***\n"
 							<< checkers::io::flush;
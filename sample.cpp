@@ -0,0 +1,89 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file sample.cpp
+ *  @brief A position labelled with its search value and game result.
+ */
+
+#include <algorithm>
+#include <limits>
+#include "sample.hpp"
+
+namespace checkers
+{
+	/** @param value The search value, saturated to 16-bit.
+	 */
+	sample::sample(const board& board, int value, int result) :
+		_black_pieces(board.get_black_pieces().get_bits()),
+		_white_pieces(board.get_white_pieces().get_bits()),
+		_kings(board.get_kings().get_bits()),
+		_value(std::max(std::min(value,
+			static_cast<int>(std::numeric_limits<int16_t>::max())),
+			static_cast<int>(-std::numeric_limits<int16_t>::max()))),
+		_black_to_move(board.is_black_to_move()),
+		_result(result)
+	{
+	}
+
+	bool sample::read(std::istream& is)
+	{
+		unsigned char buf[sample::SIZE];
+
+		if (!is.read(reinterpret_cast<char*>(buf), sizeof(buf)))
+		{
+			return false;
+		}
+
+		this->_black_pieces = buf[0] | buf[1] << 8 | buf[2] << 16 |
+			static_cast<uint32_t>(buf[3]) << 24;
+		this->_white_pieces = buf[4] | buf[5] << 8 | buf[6] << 16 |
+			static_cast<uint32_t>(buf[7]) << 24;
+		this->_kings = buf[8] | buf[9] << 8 | buf[10] << 16 |
+			static_cast<uint32_t>(buf[11]) << 24;
+		this->_value = static_cast<int16_t>(buf[12] | buf[13] << 8);
+		this->_black_to_move = buf[14];
+		this->_result = static_cast<int8_t>(buf[15]);
+
+		return true;
+	}
+
+	void sample::write(std::ostream& os) const
+	{
+		unsigned char buf[sample::SIZE];
+		unsigned int i;
+
+		for (i = 0; i < 4; ++i)
+		{
+			buf[i] = this->_black_pieces >> i * 8 & 0xff;
+			buf[4 + i] = this->_white_pieces >> i * 8 & 0xff;
+			buf[8 + i] = this->_kings >> i * 8 & 0xff;
+		}
+		buf[12] = static_cast<uint16_t>(this->_value) & 0xff;
+		buf[13] = static_cast<uint16_t>(this->_value) >> 8 & 0xff;
+		buf[14] = this->_black_to_move;
+		buf[15] = static_cast<unsigned char>(this->_result);
+
+		os.write(reinterpret_cast<const char*>(buf), sizeof(buf));
+	}
+}
+
+// End of file
@@ -0,0 +1,88 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file sample.hpp
+ *  @brief A position labelled with its search value and game result.
+ */
+
+#ifndef __SAMPLE_HPP__
+#define __SAMPLE_HPP__
+
+extern "C"
+{
+	#include <stdint.h>
+}
+#include <istream>
+#include <ostream>
+#include "board.hpp"
+
+namespace checkers
+{
+	/** @class sample
+	 *  @brief A labelled position for evaluation tuning, stored as a
+	 *   16-byte record in little-endian byte order.
+	 *
+	 *  @verbatim
+	     byte  0 -  3  dark pieces
+	     byte  4 -  7  light pieces
+	     byte  8 - 11  kings
+	     byte 12 - 13  search value, for the player on move
+	     byte 14       1 when dark is on move, otherwise 0
+	     byte 15       game result, for the player on move: 1 win,
+	                   0 draw, -1 loss @endverbatim
+	 */
+	class sample
+	{
+	public:
+		inline sample(void);
+		sample(const board& board, int value, int result);
+
+		/// Get the position.
+		inline board get_board(void) const;
+		/// Get the search value, for the player on move.
+		inline int get_value(void) const;
+		/// Get the game result, for the player on move.
+		inline int get_result(void) const;
+		/// Set the game result, for the player has dark pieces.
+		inline void set_black_result(int result);
+
+		/// Read a record, return false at the end of input.
+		bool read(std::istream& is);
+		/// Write the record.
+		void write(std::ostream& os) const;
+
+		/// The size of a record in bytes.
+		static const unsigned int SIZE = 16;
+
+	private:
+		uint32_t _black_pieces;
+		uint32_t _white_pieces;
+		uint32_t _kings;
+		int16_t _value;
+		bool _black_to_move;
+		int8_t _result;
+	};
+}
+
+#include "sample_i.hpp"
+#endif // __SAMPLE_HPP__
+// End of file
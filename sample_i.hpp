@@ -0,0 +1,63 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file sample_i.hpp
+ *  @brief A position labelled with its search value and game result.
+ */
+
+#ifndef __SAMPLE_I_HPP__
+#define __SAMPLE_I_HPP__
+
+namespace checkers
+{
+	inline sample::sample(void) :
+		_black_pieces(bitboard::EMPTY), _white_pieces(bitboard::EMPTY),
+		_kings(bitboard::EMPTY), _value(0), _black_to_move(true),
+		_result(0)
+	{
+	}
+
+	inline board sample::get_board(void) const
+	{
+		return board(bitboard(this->_black_pieces),
+			bitboard(this->_white_pieces), bitboard(this->_kings),
+			this->_black_to_move);
+	}
+
+	inline int sample::get_value(void) const
+	{
+		return this->_value;
+	}
+
+	inline int sample::get_result(void) const
+	{
+		return this->_result;
+	}
+
+	inline void sample::set_black_result(int result)
+	{
+		this->_result = this->_black_to_move ? result : -result;
+	}
+}
+
+#endif // __SAMPLE_I_HPP__
+// End of file
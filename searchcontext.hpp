@@ -0,0 +1,97 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file searchcontext.hpp
+ *  @brief The limits of a search, and the token to stop it.
+ */
+
+#ifndef __SEARCHCONTEXT_HPP__
+#define __SEARCHCONTEXT_HPP__
+
+#include "timeval.hpp"
+
+namespace checkers
+{
+	/** @class search_context
+	 *  @brief The limits of a search: the depth, the nodes and the
+	 *   deadline, and a token to stop the search.
+	 *
+	 *   The token may be set by another thread while the search runs.
+	 *   The search checks the context every so many nodes, and calls
+	 *   the poll function then, which may stop it too, e.g. when new
+	 *   input is ready.
+	 */
+	class search_context
+	{
+	public:
+		/** @brief Called every so many nodes while searching.
+		 *   Return true to stop the search.
+		 */
+		typedef bool (*poll_t)(void);
+
+		/** @param depth The depth limit in ply.
+		 *  @param second The time limit in seconds, from now.
+		 *  @param nodes The node limit, 0 for no limit.
+		 */
+		explicit inline search_context(unsigned int depth,
+			time_t second = search_context::UNLIMITED,
+			long unsigned int nodes = 0);
+
+		inline unsigned int get_depth(void) const;
+		inline long unsigned int get_nodes(void) const;
+		/// Restart the clock with the time limit of @e second.
+		inline void set_timeout(time_t second);
+		/// Set the poll function, NULL for none.
+		inline void set_poll(poll_t poll);
+
+		/// Stop the search, from any thread.
+		inline void stop(void);
+		/// Whether the search is stopped.
+		inline bool is_stopped(void) const;
+		/// Whether @e nodes reach the node limit.
+		inline bool is_out_of_nodes(long unsigned int nodes) const;
+		/** @brief Whether the search of @e nodes so far has to stop:
+		 *   the token is set, a limit is reached, or the poll function
+		 *   returns true, which sets the token.
+		 */
+		inline bool check(long unsigned int nodes);
+
+		static const int UNLIMITED = 999999;
+
+	private:
+		/// Define but not implement, to prevent object copy.
+		search_context(const search_context& rhs);
+		/// Define but not implement, to prevent object copy.
+		search_context& operator=(const search_context& rhs) const;
+
+		unsigned int _depth;
+		long unsigned int _nodes;
+		struct timeval _deadline;
+		poll_t _poll;
+		/// The stop token, read and written atomically.
+		bool _stop;
+	};
+}
+
+#include "searchcontext_i.hpp"
+#endif // __SEARCHCONTEXT_HPP__
+// End of file
@@ -0,0 +1,93 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file searchcontext_i.hpp
+ *  @brief The limits of a search, and the token to stop it.
+ */
+
+#ifndef __SEARCHCONTEXT_I_HPP__
+#define __SEARCHCONTEXT_I_HPP__
+
+namespace checkers
+{
+	inline search_context::search_context(unsigned int depth,
+		time_t second, long unsigned int nodes) :
+		_depth(depth), _nodes(nodes), _deadline(timeval::now() + second),
+		_poll(NULL), _stop(false)
+	{
+	}
+
+	inline unsigned int search_context::get_depth(void) const
+	{
+		return this->_depth;
+	}
+
+	inline long unsigned int search_context::get_nodes(void) const
+	{
+		return this->_nodes;
+	}
+
+	inline void search_context::set_timeout(time_t second)
+	{
+		this->_deadline = timeval::now() + second;
+	}
+
+	inline void search_context::set_poll(poll_t poll)
+	{
+		this->_poll = poll;
+	}
+
+	inline void search_context::stop(void)
+	{
+		__atomic_store_n(&this->_stop, true, __ATOMIC_RELEASE);
+	}
+
+	inline bool search_context::is_stopped(void) const
+	{
+		return __atomic_load_n(&this->_stop, __ATOMIC_ACQUIRE);
+	}
+
+	inline bool search_context::is_out_of_nodes(
+		long unsigned int nodes) const
+	{
+		return this->_nodes && nodes >= this->_nodes;
+	}
+
+	inline bool search_context::check(long unsigned int nodes)
+	{
+		if (this->is_stopped())
+		{
+			return true;
+		}
+		if (this->is_out_of_nodes(nodes) ||
+			timeval::now() > this->_deadline ||
+			(this->_poll && (*this->_poll)()))
+		{
+			this->stop();
+			return true;
+		}
+		return false;
+	}
+}
+
+#endif // __SEARCHCONTEXT_I_HPP__
+// End of file
@@ -0,0 +1,198 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file selfplay.cpp
+ *  @brief Generate labelled positions by self-play on multiple threads.
+ */
+
+extern "C"
+{
+	#include <stdlib.h>
+}
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "absearch.hpp"
+#include "selfplay.hpp"
+
+namespace checkers
+{
+	selfplay::selfplay(std::ostream& os, unsigned int games,
+		unsigned int depth, unsigned int random_plies,
+		long unsigned int nodes) :
+		_os(os), _games(games), _depth(depth),
+		_random_plies(random_plies), _nodes(nodes), _next_game(0),
+		_game_mutex(), _os_mutex()
+	{
+		pthread_mutex_init(&this->_game_mutex, NULL);
+		pthread_mutex_init(&this->_os_mutex, NULL);
+	}
+
+	selfplay::~selfplay(void)
+	{
+		pthread_mutex_destroy(&this->_os_mutex);
+		pthread_mutex_destroy(&this->_game_mutex);
+	}
+
+	void selfplay::run(unsigned int threads)
+	{
+		std::vector<pthread_t> tids(threads);
+		std::vector<pthread_t>::size_type i;
+		int error;
+
+		for (i = 0; i < tids.size(); ++i)
+		{
+			if ((error = pthread_create(&tids[i], NULL,
+				&selfplay::worker, this)) != 0)
+			{
+				/** @throw std::runtime_error when
+				 *   pthread_create() failed.
+				 */
+				throw std::runtime_error(
+					std::string("pthread_create() failed: ")
+					+ std::strerror(error));
+			}
+		}
+		for (i = 0; i < tids.size(); ++i)
+		{
+			pthread_join(tids[i], NULL);
+		}
+	}
+
+	/**  The random moves of a game are seeded by the game number.
+	 */
+	void* selfplay::worker(void* arg)
+	{
+		selfplay& selfplay = *static_cast<class selfplay*>(arg);
+		absearch::state state;
+		std::vector<sample> samples;
+		std::vector<packed_move> best_moves;
+		std::vector<zobrist> history;
+		unsigned int game;
+
+		while (selfplay.next_game(game))
+		{
+			unsigned int seed = game + 1;
+			unsigned int ply;
+			int result = 0;
+			board board;
+
+			for (ply = 0; ply < selfplay._random_plies; ++ply)
+			{
+				std::vector<packed_move> moves =
+					board.generate_moves();
+				if (moves.empty())
+				{
+					break;
+				}
+				board.make_move(moves[rand_r(&seed) %
+					moves.size()]);
+			}
+
+			samples.clear();
+			history.clear();
+			for (ply = 0; ply < selfplay::MAX_PLIES; ++ply)
+			{
+				if (board.is_losing())
+				{
+					result = board.is_black_to_move() ?
+						-1 : 1;
+					break;
+				}
+				// A draw by repetition or by the 40-move rule
+				if (std::count(history.begin(), history.end(),
+					board.get_zobrist()) >= 2 ||
+					board.get_reversible_moves() >=
+					board::REVERSIBLE_MOVES_LIMIT)
+				{
+					break;
+				}
+
+				state.set_history(history);
+				search_context context(selfplay._depth,
+					search_context::UNLIMITED,
+					selfplay._nodes);
+				// The line left from the last think may be
+				// longer than the depth, which is not searched.
+				best_moves.clear();
+				absearch::think(state, best_moves, board,
+					context);
+				if (best_moves.empty())
+				{
+					break;
+				}
+				samples.push_back(sample(board,
+					state.get_value(), 0));
+
+				if (board.is_reversible(best_moves.front()))
+				{
+					history.push_back(board.get_zobrist());
+				}
+				else
+				{
+					history.clear();
+				}
+				board.make_move(best_moves.front());
+			}
+
+			for (std::vector<sample>::iterator pos =
+				samples.begin(); pos != samples.end(); ++pos)
+			{
+				pos->set_black_result(result);
+			}
+			selfplay.write(samples);
+		}
+
+		return NULL;
+	}
+
+	bool selfplay::next_game(unsigned int& game)
+	{
+		bool more;
+
+		pthread_mutex_lock(&this->_game_mutex);
+		game = this->_next_game;
+		more = game < this->_games;
+		if (more)
+		{
+			++this->_next_game;
+		}
+		pthread_mutex_unlock(&this->_game_mutex);
+
+		return more;
+	}
+
+	void selfplay::write(const std::vector<sample>& samples)
+	{
+		pthread_mutex_lock(&this->_os_mutex);
+		for (std::vector<sample>::const_iterator pos = samples.begin();
+			pos != samples.end(); ++pos)
+		{
+			pos->write(this->_os);
+		}
+		this->_os << std::flush;
+		pthread_mutex_unlock(&this->_os_mutex);
+	}
+}
+
+// End of file
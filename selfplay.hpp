@@ -0,0 +1,87 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file selfplay.hpp
+ *  @brief Generate labelled positions by self-play on multiple threads.
+ */
+
+#ifndef __SELFPLAY_HPP__
+#define __SELFPLAY_HPP__
+
+extern "C"
+{
+	#include <pthread.h>
+}
+#include <ostream>
+#include <vector>
+#include "sample.hpp"
+
+namespace checkers
+{
+	/** @class selfplay
+	 *  @brief Play games of the engine against itself with fixed depth
+	 *   searches, limited to a number of nodes too when given.  Each
+	 *   game starts with a few random moves.  Every searched position
+	 *   is written out as a sample, once the game is over.
+	 */
+	class selfplay
+	{
+	public:
+		selfplay(std::ostream& os, unsigned int games,
+			unsigned int depth, unsigned int random_plies,
+			long unsigned int nodes = 0);
+		~selfplay(void);
+
+		/// Play all the games on @e threads threads.
+		void run(unsigned int threads);
+
+		/// A game is a draw after so many plies.
+		static const unsigned int MAX_PLIES = 200;
+
+	private:
+		/// Define but not implement, to prevent object copy.
+		selfplay(const selfplay& rhs);
+		/// Define but not implement, to prevent object copy.
+		selfplay& operator=(const selfplay& rhs) const;
+
+		/// The thread routine.
+		static void* worker(void* arg);
+
+		/// Get the number of the next game, return false when done.
+		bool next_game(unsigned int& game);
+		/// Write out the samples of a game.
+		void write(const std::vector<sample>& samples);
+
+		std::ostream& _os;
+		unsigned int _games;
+		unsigned int _depth;
+		unsigned int _random_plies;
+		/// The nodes of a search, 0 for no limit.
+		long unsigned int _nodes;
+		unsigned int _next_game;
+		pthread_mutex_t _game_mutex;
+		pthread_mutex_t _os_mutex;
+	};
+}
+
+#endif // __SELFPLAY_HPP__
+// End of file
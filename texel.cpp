@@ -0,0 +1,317 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file texel.cpp
+ *  @brief Tune the evaluate weights by the Texel's tuning method.
+ */
+
+extern "C"
+{
+	#include <pthread.h>
+}
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include "evaluate.hpp"
+#include "sample.hpp"
+#include "texel.hpp"
+
+namespace checkers
+{
+	texel::texel(std::istream& is, unsigned int threads) :
+		_results(), _scale(1.0 / evaluate::WEIGHT_MAN),
+		_threads(threads)
+	{
+		sample sample;
+		std::vector<float>::size_type i;
+		unsigned int j;
+
+		while (sample.read(is))
+		{
+			board board = sample.get_board();
+			if (board.is_black_to_move() ?
+				board.get_black_jumpers() :
+				board.get_white_jumpers())
+			{
+				continue;
+			}
+
+			this->_features[texel::MAN].push_back(
+				evaluate::men(board));
+			this->_features[texel::KING].push_back(
+				evaluate::kings(board));
+			this->_features[texel::MOVER].push_back(
+				evaluate::movers(board));
+			this->_features[texel::KINGS_ROW].push_back(
+				evaluate::kings_row(board));
+			this->_features[texel::EDGE].push_back(
+				evaluate::edges(board));
+			this->_features[texel::PATTERN].push_back(
+				evaluate::patterns(board));
+			this->_results.push_back((sample.get_result() + 1) / 2.0);
+		}
+
+		for (j = 0; j < FEATURES; ++j)
+		{
+			this->_moments[j] = 0.0;
+			for (i = 0; i < this->size(); ++i)
+			{
+				this->_moments[j] += this->_features[j][i] *
+					this->_features[j][i];
+			}
+			this->_moments[j] = this->size() && this->_moments[j] ?
+				this->_moments[j] / this->size() : 1.0;
+		}
+	}
+
+	texel::~texel(void)
+	{
+	}
+
+	/**  Ternary search on the logarithm of the scale.
+	 *  @return The loss with the fitted scale.
+	 */
+	double texel::fit_scale(const double weights[FEATURES])
+	{
+		double low = std::log(1e-6);
+		double high = std::log(1e-1);
+		unsigned int i;
+
+		for (i = 0; i < 100; ++i)
+		{
+			double m1 = low + (high - low) / 3;
+			double m2 = high - (high - low) / 3;
+
+			this->_scale = std::exp(m1);
+			double loss1 = this->loss(weights);
+			this->_scale = std::exp(m2);
+			double loss2 = this->loss(weights);
+
+			if (loss1 < loss2)
+			{
+				high = m2;
+			}
+			else
+			{
+				low = m1;
+			}
+		}
+		this->_scale = std::exp((low + high) / 2);
+
+		return this->loss(weights);
+	}
+
+	/**  The step is divided by the square of the scale, which is the
+	 *   same as the gradient descent on the weights times the scale, and
+	 *   by the mean square of the feature, so the features of different
+	 *   magnitudes converge alike.
+	 */
+	double texel::tune(double weights[FEATURES], unsigned int iterations,
+		double rate, bool verbose)
+	{
+		double gradient[FEATURES];
+		double loss = 0.0;
+		unsigned int i;
+		unsigned int j;
+
+		for (i = 0; i < iterations; ++i)
+		{
+			loss = this->gradient(weights, gradient);
+			for (j = 0; j < FEATURES; ++j)
+			{
+				weights[j] -= rate * gradient[j] /
+					(this->_scale * this->_scale *
+					this->_moments[j]);
+			}
+
+			if (verbose && 0 == i % 100)
+			{
+				std::cerr << std::setw(6) << i << ' ' <<
+					std::setprecision(8) << loss;
+				for (j = 0; j < FEATURES; ++j)
+				{
+					std::cerr << ' ' << std::setprecision(6)
+						<< weights[j];
+				}
+				std::cerr << std::endl;
+			}
+		}
+
+		return this->loss(weights);
+	}
+
+	double texel::loss(const double weights[FEATURES]) const
+	{
+		double gradient[FEATURES];
+
+		return this->gradient(weights, gradient);
+	}
+
+	void texel::write(std::ostream& os, const double weights[FEATURES])
+	{
+		unsigned int i;
+
+		os << "/* Generated by tuner, do not edit. */\n"
+			"\n"
+			"namespace checkers\n"
+			"{\n"
+			"\tnamespace evaluate\n"
+			"\t{\n";
+		for (i = 0; i < FEATURES; ++i)
+		{
+			std::string name = std::string("WEIGHT_") +
+				texel::name(static_cast<feature>(i));
+			os << "\t\tconst int " << std::setw(16) << std::left <<
+				name << std::right << " = " <<
+				static_cast<int>(std::floor(weights[i] + 0.5))
+				<< ";\n";
+		}
+		os << "\t}\n"
+			"}\n"
+			"\n"
+			"// End of file\n";
+	}
+
+	const char* texel::name(feature feature)
+	{
+		switch (feature)
+		{
+		case texel::MAN:
+			return "MAN";
+		case texel::KING:
+			return "KING";
+		case texel::MOVER:
+			return "MOVER";
+		case texel::KINGS_ROW:
+			return "KINGS_ROW";
+		case texel::EDGE:
+			return "EDGE";
+		case texel::PATTERN:
+			return "PATTERN";
+		default:
+			return "";
+		}
+	}
+
+	// ================================================================
+
+	/** @return The mean loss.
+	 */
+	double texel::gradient(const double weights[FEATURES],
+		double gradient[FEATURES]) const
+	{
+		std::vector<slice> slices(this->_threads);
+		std::vector<pthread_t> tids(this->_threads);
+		std::vector<slice>::size_type i;
+		unsigned int j;
+		double loss = 0.0;
+		int error;
+
+		for (i = 0; i < slices.size(); ++i)
+		{
+			slices[i]._texel = this;
+			slices[i]._weights = weights;
+			slices[i]._begin = this->size() * i / slices.size();
+			slices[i]._end = this->size() * (i + 1) / slices.size();
+
+			if ((error = pthread_create(&tids[i], NULL,
+				&texel::worker, &slices[i])) != 0)
+			{
+				/** @throw std::runtime_error when
+				 *   pthread_create() failed.
+				 */
+				throw std::runtime_error(
+					std::string("pthread_create() failed: ")
+					+ std::strerror(error));
+			}
+		}
+
+		for (j = 0; j < FEATURES; ++j)
+		{
+			gradient[j] = 0.0;
+		}
+		for (i = 0; i < slices.size(); ++i)
+		{
+			pthread_join(tids[i], NULL);
+
+			loss += slices[i]._loss;
+			for (j = 0; j < FEATURES; ++j)
+			{
+				gradient[j] += slices[i]._gradient[j];
+			}
+		}
+
+		if (this->size())
+		{
+			loss /= this->size();
+			for (j = 0; j < FEATURES; ++j)
+			{
+				gradient[j] /= this->size();
+			}
+		}
+
+		return loss;
+	}
+
+	void* texel::worker(void* arg)
+	{
+		slice& slice = *static_cast<struct slice*>(arg);
+		const texel& texel = *slice._texel;
+		std::vector<float>::size_type i;
+		unsigned int j;
+
+		slice._loss = 0.0;
+		for (j = 0; j < FEATURES; ++j)
+		{
+			slice._gradient[j] = 0.0;
+		}
+
+		for (i = slice._begin; i < slice._end; ++i)
+		{
+			double value = 0.0;
+			for (j = 0; j < FEATURES; ++j)
+			{
+				value += slice._weights[j] *
+					texel._features[j][i];
+			}
+
+			double s = 1.0 / (1.0 + std::exp(-texel._scale * value));
+			double r = texel._results[i];
+			s = std::min(std::max(s, 1e-12), 1.0 - 1e-12);
+
+			slice._loss -= r * std::log(s) +
+				(1.0 - r) * std::log(1.0 - s);
+			for (j = 0; j < FEATURES; ++j)
+			{
+				slice._gradient[j] += (s - r) * texel._scale *
+					texel._features[j][i];
+			}
+		}
+
+		return NULL;
+	}
+}
+
+// End of file
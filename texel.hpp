@@ -0,0 +1,118 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file texel.hpp
+ *  @brief Tune the evaluate weights by the Texel's tuning method.
+ */
+
+#ifndef __TEXEL_HPP__
+#define __TEXEL_HPP__
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace checkers
+{
+	/** @class texel
+	 *  @brief Fit the weights of evaluate::evaluate() to game results.
+	 *
+	 *   The value of a position is mapped to an expected result by
+	 *   sigmoid(scale * value), the weights are fitted by gradient
+	 *   descent on the logistic loss against the game results.  The
+	 *   features of all the positions are evaluated once and kept in
+	 *   one array per feature, the loss and the gradient are summed on
+	 *   multiple threads.
+	 */
+	class texel
+	{
+	public:
+		enum feature
+		{
+			MAN = 0,
+			KING,
+			MOVER,
+			KINGS_ROW,
+			EDGE,
+			PATTERN,
+			/// The number of features.
+			FEATURES
+		};
+
+		/** @brief Load the samples written by self-play.  Positions
+		 *   with a capture are skipped, which are not quiet.
+		 */
+		texel(std::istream& is, unsigned int threads);
+		~texel(void);
+
+		/// Get the number of the loaded positions.
+		inline std::vector<float>::size_type size(void) const;
+		/// Get the scale of the sigmoid.
+		inline double get_scale(void) const;
+
+		/// Fit the scale of the sigmoid to the @e weights.
+		double fit_scale(const double weights[FEATURES]);
+		/// Fit the @e weights, return the loss.
+		double tune(double weights[FEATURES], unsigned int iterations,
+			double rate, bool verbose);
+		/// Get the loss of the @e weights.
+		double loss(const double weights[FEATURES]) const;
+
+		/// Write out a source file of the weights for evaluate.hpp.
+		static void write(std::ostream& os,
+			const double weights[FEATURES]);
+
+		/// The name of a feature.
+		static const char* name(feature feature);
+
+	private:
+		/// The work of one thread, a slice of the positions.
+		struct slice
+		{
+			const texel* _texel;
+			const double* _weights;
+			std::vector<float>::size_type _begin;
+			std::vector<float>::size_type _end;
+			double _loss;
+			double _gradient[FEATURES];
+		};
+
+		/// Sum the loss and the gradient on all the threads.
+		double gradient(const double weights[FEATURES],
+			double gradient[FEATURES]) const;
+		/// The thread routine.
+		static void* worker(void* arg);
+
+		std::vector<float> _features[FEATURES];
+		/// Game results, 1 win, 0.5 draw, 0 loss.
+		std::vector<float> _results;
+		/// The mean square of each feature.
+		double _moments[FEATURES];
+		double _scale;
+		unsigned int _threads;
+	};
+}
+
+#include "texel_i.hpp"
+#endif // __TEXEL_HPP__
+// End of file
@@ -0,0 +1,182 @@
+/* $Id$
+
+   This file is a part of ponder, a English/American checkers game.
+
+   Copyright (c) 2026 Quux Information.
+                     Gong Jie <neo@quux.me>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Steet, Fifth Floor,
+   Boston, MA 02110-1301, USA.
+ */
+/** @file tuner.cpp
+ *  @brief Tune the evaluate weights with the samples of self-play.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "evaluate.hpp"
+#include "texel.hpp"
+
+void usage(void)
+{
+	std::cerr
+		<< "Usage: tuner --samples FILE [--iterations N] [--rate RATE]"
+			" [--threads N]\n"
+		<< "             [--weights FILE] [--output FILE] [--verbose]\n"
+		<< std::flush;
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		std::string samples;
+		std::string output("-");
+		int iterations = 1000;
+		double rate = 1.0;
+		int threads = 1;
+		bool verbose = false;
+		int i = 0;
+
+		while (++i < argc)
+		{
+			if ("--samples" == std::string(argv[i]) && ++i < argc)
+			{
+				samples = argv[i];
+			}
+			else if ("--iterations" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				iterations = std::strtol(argv[i], NULL, 10);
+				if (iterations < 0)
+				{
+					std::cerr << "Error: Invalid iterations"
+						<< std::endl;
+					std::exit(255);
+				}
+			}
+			else if ("--rate" == std::string(argv[i]) && ++i < argc)
+			{
+				rate = std::strtod(argv[i], NULL);
+				if (rate <= 0.0)
+				{
+					std::cerr << "Error: Invalid rate"
+						<< std::endl;
+					std::exit(255);
+				}
+			}
+			else if ("--threads" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				threads = std::strtol(argv[i], NULL, 10);
+				if (threads < 1 || threads > 256)
+				{
+					std::cerr << "Error: Invalid threads"
+						<< std::endl;
+					std::exit(255);
+				}
+			}
+			else if ("--weights" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				std::ifstream weights(argv[i]);
+				if (!weights)
+				{
+					std::cerr << "Error: Cannot open "
+						<< argv[i] << std::endl;
+					std::exit(255);
+				}
+				checkers::evaluate::load_weights(weights);
+			}
+			else if ("--output" == std::string(argv[i]) &&
+				++i < argc)
+			{
+				output = argv[i];
+			}
+			else if ("--verbose" == std::string(argv[i]))
+			{
+				verbose = true;
+			}
+			else
+			{
+				usage();
+				std::exit(255);
+			}
+		}
+
+		if (samples.empty())
+		{
+			usage();
+			std::exit(255);
+		}
+
+		std::ifstream ifs(samples.c_str(), std::ios::binary);
+		if (!ifs)
+		{
+			std::cerr << "Error: Cannot open " << samples
+				<< std::endl;
+			std::exit(255);
+		}
+		checkers::texel texel(ifs, threads);
+
+		const checkers::evaluate::weights& initial =
+			checkers::evaluate::get_weights();
+		double weights[checkers::texel::FEATURES];
+		weights[checkers::texel::MAN] = initial.man;
+		weights[checkers::texel::KING] = initial.king;
+		weights[checkers::texel::MOVER] = initial.mover;
+		weights[checkers::texel::KINGS_ROW] = initial.kings_row;
+		weights[checkers::texel::EDGE] = initial.edge;
+		weights[checkers::texel::PATTERN] = initial.pattern;
+
+		double loss = texel.fit_scale(weights);
+		std::cerr << "Positions: " << texel.size() << ", scale: " <<
+			texel.get_scale() << ", loss: " << loss << std::endl;
+		loss = texel.tune(weights, iterations, rate, verbose);
+		std::cerr << "Loss: " << loss << std::endl;
+
+		if ("-" == output)
+		{
+			checkers::texel::write(std::cout, weights);
+		}
+		else
+		{
+			std::ofstream ofs(output.c_str());
+			if (!ofs)
+			{
+				std::cerr << "Error: Cannot open " << output
+					<< std::endl;
+				std::exit(255);
+			}
+			checkers::texel::write(ofs, weights);
+		}
+	}
+	catch (std::exception& e)
+	{
+		std::cerr << "Fatal error: " << e.what() << std::endl;
+		return 1;
+	}
+	catch (...)
+	{
+		std::cerr << "Fatal error: unknown exception!" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+// End of file
@@ -28,9 +28,20 @@
 
 namespace checkers
 {
+	/**  All the 64 bits of the keys are independent, so the keys of
+	 *   different positions rarely collide, and the low bits index the
+	 *   hash table evenly.
+	 */
 	uint64_t zobrist::rand64(void)
 	{
-		return uint64_t(rand32()) << 32 | uint64_t(rand32());
+		static uint64_t seed = uint64_t(0x9e3779b9UL) << 32 |
+			uint64_t(0x7f4a7c15UL);
+
+		seed ^= seed >> 12;
+		seed ^= seed << 25;
+		seed ^= seed >> 27;
+		return seed * (uint64_t(0x2545f491UL) << 32 |
+			uint64_t(0x4f6cdd1dUL));
 	}
 
 	uint64_t zobrist::_black_pieces[] =
@@ -67,6 +78,42 @@ namespace checkers
 		rand64(), rand64(), rand64(), rand64(),
 	};
 	uint64_t zobrist::_change_side = rand64();
+
+	/**  A man moved to the kings row is crowned.
+	 */
+	bool zobrist::init_moves(void)
+	{
+		for (unsigned int src = 0; src < 32; ++src)
+		{
+			for (unsigned int dest = 0; dest < 32; ++dest)
+			{
+				const uint64_t black = _black_pieces[src] ^
+					_black_pieces[dest] ^ _change_side;
+				const uint64_t white = _white_pieces[src] ^
+					_white_pieces[dest] ^ _change_side;
+				const uint64_t king = _kings[src] ^ _kings[dest];
+
+				_moves[0][src][dest] = black ^
+					(bitboard::BLACK_KINGS_ROW >> dest & 0x1U ?
+					_kings[dest] : 0);
+				_moves[1][src][dest] = black ^ king;
+				_moves[2][src][dest] = white ^
+					(bitboard::WHITE_KINGS_ROW >> dest & 0x1U ?
+					_kings[dest] : 0);
+				_moves[3][src][dest] = white ^ king;
+			}
+
+			_captures[0][src] = _white_pieces[src];
+			_captures[1][src] = _white_pieces[src] ^ _kings[src];
+			_captures[2][src] = _black_pieces[src];
+			_captures[3][src] = _black_pieces[src] ^ _kings[src];
+		}
+		return true;
+	}
+
+	uint64_t zobrist::_moves[4][32][32];
+	uint64_t zobrist::_captures[4][32];
+	bool zobrist::_moves_init = zobrist::init_moves();
 }
 
 // End of file
@@ -33,6 +33,7 @@ extern "C"
 }
 #include <cassert>
 #include "bitboard.hpp"
+#include "packedmove.hpp"
 
 namespace checkers
 {
@@ -51,12 +52,18 @@ namespace checkers
 		void inline change_white_piece(const bitboard& piece);
 		void inline change_king(const bitboard& piece);
 		void inline change_side(void);
+		/** @brief Change the pieces of a move which ends the turn, and
+		 *   the side, in one step.
+		 *  @param black Whether the player has dark pieces moves.
+		 *  @param king Whether the piece moved is a king.
+		 */
+		void inline change_move(const packed_move& move, bool black,
+			bool king);
 
 		friend bool operator ==(const zobrist& lhs, const zobrist& rhs);
 
 	private:
-		static inline uint16_t rand16(void);
-		static inline uint32_t rand32(void);
+		/// The xorshift64* pseudorandom number generator.
 		static uint64_t rand64(void);
 
 		static uint64_t _black_pieces[];
@@ -64,6 +71,20 @@ namespace checkers
 		static uint64_t _kings[];
 		static uint64_t _change_side;
 
+		/// Precombine the keys of the moves and the captures.
+		static bool init_moves(void);
+
+		/** @brief The keys of a move by the piece moved (dark man,
+		 *   dark king, light man, light king), the source and the
+		 *   destination squares, with the crown and the side.
+		 */
+		static uint64_t _moves[4][32][32];
+		/** @brief The keys of a capture by the piece captured (light
+		 *   man, light king, dark man, dark king) and the square.
+		 */
+		static uint64_t _captures[4][32];
+		static bool _moves_init;
+
 		uint64_t _key;
 	};
 
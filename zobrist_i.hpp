@@ -62,18 +62,21 @@ namespace checkers
 		this->_key ^= this->_change_side;
 	}
 
-	inline uint16_t zobrist::rand16(void)
+	/**  The capture is masked in without a branch.
+	 */
+	inline void zobrist::change_move(const packed_move& move, bool black,
+		bool king)
 	{
-		static uint32_t seed = 0UL;
-		seed = (uint32_t(9301UL) * seed + uint32_t(49297UL)) %
-			uint32_t(233280UL);
-
-		return uint16_t(seed);
-	}
-
-	inline uint32_t zobrist::rand32(void)
-	{
-		return uint32_t(rand16()) << 16 | uint32_t(rand16());
+		const unsigned int color = black ? 0 : 2;
+		const uint64_t capture = -uint64_t(bool(move.get_capture()));
+
+		assert(move.will_crown() == (!king && bool(move.get_dest() &
+			(black ? bitboard::BLACK_KINGS_ROW + 0 :
+			bitboard::WHITE_KINGS_ROW + 0))));
+		this->_key ^= zobrist::_moves[color | king]
+			[move.get_src_square()][move.get_dest_square()] ^
+			(capture & zobrist::_captures[color |
+			move.will_capture_a_king()][move.get_capture_square()]);
 	}
 
 	inline bool operator ==(const zobrist& lhs, const zobrist& rhs)